@@ -2,13 +2,27 @@
 #include <OpenGL/glu.h>
 #include <GLUT/glut.h>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cmath>
+#include <condition_variable>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
+#include <fcntl.h>
 #include <fstream>
+#include <functional>
 #include <limits>
+#include <mutex>
+#include <new>
 #include <sstream>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
 #include <vector>
 
 // Math namespace
@@ -22,10 +36,31 @@ inline float deg2rad(float d) {
     return d * PI / 180.f;
 }
 
+// RNG state
+std::uint64_t gRngState = 0x9E3779B97F4A7C15ull;
+
+// Seed RNG
+inline void seedRng(std::uint64_t seed) {
+    // Avoid zero
+    gRngState = seed ? seed : 1;
+}
+
+// Next random
+inline std::uint64_t nextRandom64() {
+    // Advance state
+    std::uint64_t z = (gRngState += 0x9E3779B97F4A7C15ull);
+    // Mix bits
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    // Mix again
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    // Final xorshift
+    return z ^ (z >> 31);
+}
+
 // Random 0-1
 inline float frand01() {
-    // Normalize random
-    return std::rand() / float(RAND_MAX);
+    // Mantissa bits
+    return (nextRandom64() >> 40) * (1.0f / 16777216.0f);
 }
 
 // Random range
@@ -33,6 +68,58 @@ inline float frandRange(float a, float b) {
     // Interpolate range
     return a + (b - a) * frand01();
 }
+
+// Trig table size
+constexpr int trigTableSize = 2048;
+// Degrees to index
+constexpr float trigTableScale = trigTableSize / 360.f;
+// Sine table
+float gSinTable[trigTableSize + 1];
+// Cosine table
+float gCosTable[trigTableSize + 1];
+
+// Build tables
+inline void initTrigTables() {
+    // Each entry
+    for (int i = 0; i <= trigTableSize; ++i) {
+        // Entry angle
+        const float a = deg2rad(i * (360.f / trigTableSize));
+        // Tabulate sine
+        gSinTable[i] = std::sin(a);
+        // Tabulate cosine
+        gCosTable[i] = std::cos(a);
+    }
+}
+
+// Table index
+inline float trigIndex(float deg) {
+    // Scaled angle
+    float t = deg * trigTableScale;
+    // Wrap index
+    t -= trigTableSize * std::floor(t * (1.f / trigTableSize));
+    // Fractional index
+    return t;
+}
+
+// Table sine
+inline float sinDeg(float deg) {
+    // Fractional index
+    const float t = trigIndex(deg);
+    // Whole index
+    const int i = (int)t;
+    // Interpolate entries
+    return gSinTable[i] + (gSinTable[i + 1] - gSinTable[i]) * (t - i);
+}
+
+// Table cosine
+inline float cosDeg(float deg) {
+    // Fractional index
+    const float t = trigIndex(deg);
+    // Whole index
+    const int i = (int)t;
+    // Interpolate entries
+    return gCosTable[i] + (gCosTable[i + 1] - gCosTable[i]) * (t - i);
+}
 }
 
 // Vector structure
@@ -97,6 +184,213 @@ inline void normalize(Vector& v) {
     }
 }
 
+// Bump arena
+struct Arena {
+    // Backing storage
+    std::vector<unsigned char> storage;
+    // Bump offset
+    size_t offset = 0;
+    // Peak usage
+    size_t peak = 0;
+    // Overflow blocks
+    std::vector<void*> overflow;
+};
+
+// Prepare arena
+static void arenaInit(Arena& arena, size_t capacity) {
+    // Reserve storage
+    arena.storage.resize(capacity);
+    // Rewind offset
+    arena.offset = 0;
+}
+
+// Bump allocate
+static void* arenaAlloc(Arena& arena, size_t bytes, size_t align) {
+    // Aligned offset
+    const size_t at = (arena.offset + align - 1) & ~(align - 1);
+    // Check capacity
+    if (at + bytes > arena.storage.size()) {
+        // Heap fallback
+        void* block = std::malloc(bytes);
+        // Track block
+        arena.overflow.push_back(block);
+        // Fallback memory
+        return block;
+    }
+    // Advance offset
+    arena.offset = at + bytes;
+    // Track peak
+    arena.peak = std::max(arena.peak, arena.offset);
+    // Bump memory
+    return arena.storage.data() + at;
+}
+
+// Typed allocate
+template <typename T>
+static T* arenaAllocT(Arena& arena, size_t count) {
+    // Typed block
+    return (T*)arenaAlloc(arena, count * sizeof(T), alignof(T));
+}
+
+// Recycle arena
+static void arenaReset(Arena& arena) {
+    // Rewind offset
+    arena.offset = 0;
+    // Each overflow
+    for (void* block : arena.overflow) {
+        // Release block
+        std::free(block);
+    }
+    // Forget blocks
+    arena.overflow.clear();
+}
+
+// Frame arena
+Arena gFrameArena;
+// Load arena
+Arena gLoadArena;
+
+// Allocation phases
+enum AllocPhase { AllocIdle, AllocSim, AllocDraw, AllocPhaseCount };
+
+#ifdef ALLOC_TRACK
+// Phase names
+const char* const allocPhaseNames[AllocPhaseCount] = {"idle", "sim", "draw"};
+// Current phase
+std::atomic<int> gAllocPhase{AllocIdle};
+// Phase counts
+std::atomic<long> gAllocCount[AllocPhaseCount] = {};
+// Phase bytes
+std::atomic<long> gAllocBytes[AllocPhaseCount] = {};
+// Site capacity
+constexpr int allocSiteMax = 8;
+// Site ring
+std::atomic<void*> gAllocSites[allocSiteMax] = {};
+// Site cursor
+std::atomic<int> gAllocSiteCount{0};
+
+// Track allocation
+static void allocNote(size_t bytes, void* site) {
+    // Current phase
+    const int phase = gAllocPhase.load(std::memory_order_relaxed);
+    // Untracked phase
+    if (phase == AllocIdle) {
+        // Skip
+        return;
+    }
+    // Count allocation
+    gAllocCount[phase].fetch_add(1, std::memory_order_relaxed);
+    // Count bytes
+    gAllocBytes[phase].fetch_add((long)bytes, std::memory_order_relaxed);
+    // Claim slot
+    const int slot = gAllocSiteCount.fetch_add(1, std::memory_order_relaxed);
+    // Record site
+    if (slot < allocSiteMax) {
+        // Store address
+        gAllocSites[slot].store(site, std::memory_order_relaxed);
+    }
+}
+
+// Tracked new
+void* operator new(size_t bytes) {
+    // Raw memory
+    void* p = std::malloc(bytes);
+    // Check failure
+    if (!p) {
+        // Signal exhaustion
+        throw std::bad_alloc();
+    }
+    // Note allocation
+    allocNote(bytes, __builtin_return_address(0));
+    // Allocated memory
+    return p;
+}
+
+// Tracked array new
+void* operator new[](size_t bytes) {
+    // Raw memory
+    void* p = std::malloc(bytes);
+    // Check failure
+    if (!p) {
+        // Signal exhaustion
+        throw std::bad_alloc();
+    }
+    // Note allocation
+    allocNote(bytes, __builtin_return_address(0));
+    // Allocated memory
+    return p;
+}
+
+// Tracked delete
+void operator delete(void* p) noexcept {
+    // Release memory
+    std::free(p);
+}
+
+// Tracked array delete
+void operator delete[](void* p) noexcept {
+    // Release memory
+    std::free(p);
+}
+
+// Sized delete
+void operator delete(void* p, size_t) noexcept {
+    // Release memory
+    std::free(p);
+}
+
+// Sized array delete
+void operator delete[](void* p, size_t) noexcept {
+    // Release memory
+    std::free(p);
+}
+
+// Set phase
+static void allocSetPhase(AllocPhase phase) {
+    // Publish phase
+    gAllocPhase.store(phase, std::memory_order_relaxed);
+}
+
+// Report frame
+static void allocFrameReport() {
+    // Stop tracking
+    gAllocPhase.store(AllocIdle, std::memory_order_relaxed);
+
+    // Any allocations
+    bool any = false;
+    // Each phase
+    for (int ph = AllocSim; ph < AllocPhaseCount; ++ph) {
+        // Drain count
+        const long count = gAllocCount[ph].exchange(0, std::memory_order_relaxed);
+        // Drain bytes
+        const long bytes = gAllocBytes[ph].exchange(0, std::memory_order_relaxed);
+        // Check count
+        if (count > 0) {
+            // Report phase
+            std::printf("alloc: %-4s %ld allocs %ld bytes\n", allocPhaseNames[ph], count, bytes);
+            // Flag hit
+            any = true;
+        }
+    }
+
+    // Drain sites
+    const int sites = std::min(allocSiteMax, gAllocSiteCount.exchange(0, std::memory_order_relaxed));
+    // Check hit
+    if (any) {
+        // Each site
+        for (int i = 0; i < sites; ++i) {
+            // Report site
+            std::printf("alloc:   site %p\n", gAllocSites[i].load(std::memory_order_relaxed));
+        }
+    }
+}
+#else
+// Set phase
+static inline void allocSetPhase(AllocPhase) {}
+// Report frame
+static inline void allocFrameReport() {}
+#endif
+
 // Camera yaw
 constexpr float camYaw   = 0.f;
 // Camera pitch
@@ -110,6 +404,19 @@ Vector gCamPos      = { 0.0f, 8.0f, 85.0f };
 // Movement speed
 float  gMoveSpeed   = 25.0f;
 
+// Simulation rate
+constexpr float simTickHz = 240.f;
+// Simulation step
+constexpr float simDt = 1.f / simTickHz;
+// Frame delta cap
+constexpr float simMaxFrameDt = 0.25f;
+// Step accumulator
+double gSimAccumulator = 0.0;
+// Interpolation alpha
+float  gSimAlpha = 1.f;
+// Previous camera
+Vector gCamPrevPos = gCamPos;
+
 
 // Forward key
 bool kForward = false;
@@ -128,15 +435,337 @@ bool kLeft = false;
 // Orbit visibility
 bool gShowOrbits = true;
 
+// Worker threads
+std::vector<std::thread> gWorkers;
+// Pool mutex
+std::mutex gPoolMutex;
+// Job condition
+std::condition_variable gPoolCv;
+// Done condition
+std::condition_variable gPoolDoneCv;
+// Job kernel
+std::function<void(int, int)> gPoolFn;
+// Next chunk
+int gPoolNext = 0;
+// Range end
+int gPoolEnd = 0;
+// Chunk size
+int gPoolChunk = 1;
+// Running chunks
+int gPoolActive = 0;
+// Pool shutdown
+bool gPoolQuit = false;
+
+// Worker loop
+static void workerMain() {
+    // Hold lock
+    std::unique_lock<std::mutex> lock(gPoolMutex);
+    // Forever
+    for (;;) {
+        // Wait work
+        gPoolCv.wait(lock, [] { return gPoolQuit || gPoolNext < gPoolEnd; });
+        // Check shutdown
+        if (gPoolQuit) {
+            // Exit thread
+            return;
+        }
+        // Drain chunks
+        while (gPoolNext < gPoolEnd) {
+            // Chunk begin
+            const int b = gPoolNext;
+            // Chunk end
+            const int e = std::min(gPoolEnd, b + gPoolChunk);
+            // Claim chunk
+            gPoolNext = e;
+            // Mark running
+            ++gPoolActive;
+            // Release lock
+            lock.unlock();
+            // Run kernel
+            gPoolFn(b, e);
+            // Retake lock
+            lock.lock();
+            // Mark finished
+            --gPoolActive;
+        }
+        // Signal completion
+        gPoolDoneCv.notify_all();
+    }
+}
+
+// Stop pool
+static void shutdownWorkerPool() {
+    // Signal scope
+    {
+        // Hold lock
+        std::lock_guard<std::mutex> lock(gPoolMutex);
+        // Request shutdown
+        gPoolQuit = true;
+    }
+    // Wake workers
+    gPoolCv.notify_all();
+    // Each worker
+    for (auto& worker : gWorkers) {
+        // Join worker
+        worker.join();
+    }
+    // Drop workers
+    gWorkers.clear();
+}
+
+// Start pool
+static void initWorkerPool() {
+    // Thread count
+    const int count = std::max(1u, std::thread::hardware_concurrency()) - 1;
+    // Spawn workers
+    for (int i = 0; i < count; ++i) {
+        // New worker
+        gWorkers.emplace_back(workerMain);
+    }
+    // Join at exit
+    std::atexit(shutdownWorkerPool);
+}
+
+// Wait pool
+static void poolWait() {
+    // Hold lock
+    std::unique_lock<std::mutex> lock(gPoolMutex);
+    // Wait idle
+    gPoolDoneCv.wait(lock, [] { return gPoolNext >= gPoolEnd && gPoolActive == 0; });
+}
+
+// Dispatch async
+static void poolRunAsync(int n, std::function<void(int, int)> fn) {
+    // No workers
+    if (gWorkers.empty()) {
+        // Run inline
+        fn(0, n);
+        // Done
+        return;
+    }
+    // Publish job
+    {
+        // Hold lock
+        std::lock_guard<std::mutex> lock(gPoolMutex);
+        // Set kernel
+        gPoolFn = std::move(fn);
+        // Reset cursor
+        gPoolNext = 0;
+        // Set end
+        gPoolEnd = n;
+        // Set chunk
+        gPoolChunk = std::max(1, n / (int)(gWorkers.size() * 4));
+    }
+    // Wake workers
+    gPoolCv.notify_all();
+}
+
+// Profiler stages
+enum ProfStage { ProfSim = 0, ProfStars, ProfRings, ProfPlanets, ProfMesh, ProfStageCount };
+// Stage names
+const char* profStageNames[ProfStageCount] = {"sim", "stars", "rings", "planets", "mesh"};
+// Stage starts
+double gProfStart[ProfStageCount] = {};
+// Stage times
+double gProfStageMs[ProfStageCount] = {};
+// History size
+constexpr int profHistorySize = 240;
+// Frame history
+double gProfFrameMs[profHistorySize] = {};
+// History cursor
+int gProfCursor = 0;
+// Sample count
+int gProfSamples = 0;
+// HUD visibility
+bool gShowHud = false;
+// CSV stream
+std::FILE* gProfCsv = nullptr;
+// Frame counter
+long gProfFrame = 0;
+
+// Benchmark enabled
+bool gBenchMode = false;
+// Benchmark length
+int gBenchFrames = 1000;
+// Benchmark cursor
+int gBenchFrameIndex = 0;
+// Benchmark totals
+std::vector<double> gBenchTotals;
+// Benchmark stages
+double gBenchStageMs[ProfStageCount] = {};
+
+// Current milliseconds
+static inline double profNowMs() {
+    // Monotonic time
+    return std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Begin stage
+static inline void profBegin(int stage) {
+    // Record start
+    gProfStart[stage] = profNowMs();
+}
+
+// End stage
+static inline void profEnd(int stage) {
+    // Accumulate elapsed
+    gProfStageMs[stage] += profNowMs() - gProfStart[stage];
+}
+
+// Reset stages
+static inline void profFrameReset() {
+    // Each stage
+    for (int i = 0; i < ProfStageCount; ++i) {
+        // Clear time
+        gProfStageMs[i] = 0.0;
+    }
+}
+
+// Record frame
+static void profFrameRecord(double frameMs) {
+    // Store sample
+    gProfFrameMs[gProfCursor] = frameMs;
+    // Advance cursor
+    gProfCursor = (gProfCursor + 1) % profHistorySize;
+    // Grow count
+    gProfSamples = std::min(gProfSamples + 1, profHistorySize);
+    // Next frame
+    ++gProfFrame;
+
+    // Stream CSV
+    if (gProfCsv) {
+        // Frame columns
+        std::fprintf(gProfCsv, "%ld,%.3f", gProfFrame, frameMs);
+        // Stage columns
+        for (int i = 0; i < ProfStageCount; ++i) {
+            // Stage value
+            std::fprintf(gProfCsv, ",%.3f", gProfStageMs[i]);
+        }
+        // End row
+        std::fprintf(gProfCsv, "\n");
+    }
+}
+
+// Toggle CSV
+static void profToggleCsv() {
+    // Currently open
+    if (gProfCsv) {
+        // Close stream
+        std::fclose(gProfCsv);
+        // Clear handle
+        gProfCsv = nullptr;
+        // Report stop
+        std::printf("profiler: stopped CSV capture\n");
+        // Done
+        return;
+    }
+    // Open stream
+    gProfCsv = std::fopen("profile.csv", "w");
+    // Check open
+    if (gProfCsv) {
+        // Header frame
+        std::fprintf(gProfCsv, "frame,total_ms");
+        // Header stages
+        for (int i = 0; i < ProfStageCount; ++i) {
+            // Stage name
+            std::fprintf(gProfCsv, ",%s_ms", profStageNames[i]);
+        }
+        // End header
+        std::fprintf(gProfCsv, "\n");
+        // Report start
+        std::printf("profiler: streaming to profile.csv\n");
+    }
+}
+
+// Quality level
+int gQualityLevel = 0;
+// Quality ceiling
+constexpr int qualityLevelMax = 2;
+// Frame budget
+constexpr double qualityBudgetMs = 18.0;
+// Step cooldown
+constexpr int qualityCooldownFrames = 120;
+// Cooldown counter
+int gQualityCooldown = 0;
+
+// Quality governor
+static void qualityGovernorUpdate() {
+    // Cooling down
+    if (gQualityCooldown > 0) {
+        // Wait out
+        --gQualityCooldown;
+        // Not yet
+        return;
+    }
+    // Need history
+    if (gProfSamples < profHistorySize) {
+        // Too early
+        return;
+    }
+
+    // Sorted samples
+    double* sorted = arenaAllocT<double>(gFrameArena, gProfSamples);
+    // Copy history
+    std::memcpy(sorted, gProfFrameMs, gProfSamples * sizeof(double));
+    // P95 index
+    const int i95 = (int)(gProfSamples * 0.95);
+    // Partial sort
+    std::nth_element(sorted, sorted + i95, sorted + gProfSamples);
+    // P95 time
+    const double p95 = sorted[i95];
+
+    // Over budget
+    if (p95 > qualityBudgetMs && gQualityLevel < qualityLevelMax) {
+        // Step down
+        ++gQualityLevel;
+        // Report step
+        std::printf("quality: p95 %.2f ms over budget, level -> %d\n", p95, gQualityLevel);
+        // Start cooldown
+        gQualityCooldown = qualityCooldownFrames;
+    }
+    // Clear headroom
+    else if (p95 < qualityBudgetMs * 0.7 && gQualityLevel > 0) {
+        // Step up
+        --gQualityLevel;
+        // Report step
+        std::printf("quality: p95 %.2f ms with headroom, level -> %d\n", p95, gQualityLevel);
+        // Start cooldown
+        gQualityCooldown = qualityCooldownFrames;
+    }
+}
+
 // Sphere quadric
 GLUquadric* gQuad = nullptr;
+// LOD count
+constexpr int sphereLodCount = 3;
+// LOD slices
+constexpr int sphereLodSlices[sphereLodCount] = {8, 16, 36};
+// LOD stacks
+constexpr int sphereLodStacks[sphereLodCount] = {6, 12, 24};
+// LOD lists
+GLuint gSphereLods[sphereLodCount] = {};
+// Pixels per unit
+float gPixelsPerUnit = 0.f;
+
+// Orbit ring
+struct OrbitRing {
+    // Ring buffer
+    GLuint vbo = 0;
+    // Vertex count
+    GLsizei count = 0;
+};
 
 // Moon structure
 struct Moon {
     // Moon properties
     float radius, orbitR, speed, angle;
+    // Body slot
+    int body;
     // Moon colour
     float colour[3];
+    // Cached ring
+    OrbitRing ring;
 };
 
 // Planet
@@ -145,8 +774,12 @@ struct Planet {
     float radius, orbitRX, orbitRY;
     // Planet motion
     float speed, angle, tilt;
+    // Body slot
+    int body;
     // Planet colour
     float colour[3];
+    // Cached ring
+    OrbitRing ring;
     // Planet moons
     std::vector<Moon> moons;
 };
@@ -154,6 +787,27 @@ struct Planet {
 // Planets
 std::vector<Planet> gPlanets;
 
+// Body angles
+std::vector<float> gBodyAngle;
+// Body previous angles
+std::vector<float> gBodyPrevAngle;
+// Body speeds
+std::vector<float> gBodySpeed;
+// Body orbit X radii
+std::vector<float> gBodyOrbitRX;
+// Body orbit Z radii
+std::vector<float> gBodyOrbitRZ;
+// Body parents
+std::vector<int>   gBodyParent;
+// Body local X
+std::vector<float> gBodyLocalX;
+// Body local Z
+std::vector<float> gBodyLocalZ;
+// Body world X
+std::vector<float> gBodyPosX;
+// Body world Z
+std::vector<float> gBodyPosZ;
+
 // Star
 struct Star {
     // Position xyz
@@ -174,6 +828,53 @@ constexpr int   starCount = 200;
 constexpr float starMinR = 80.f;
 // Maximum radius
 constexpr float starMaxR = 150.f;
+// Runtime star count
+int   gStarCount = starCount;
+// Runtime minimum radius
+float gStarMinR = starMinR;
+// Runtime maximum radius
+float gStarMaxR = starMaxR;
+// Bucket count
+constexpr int   starBucketCount = 5;
+// Bucket sizes
+constexpr float starBucketSizes[starBucketCount] = {1.5f, 2.0f, 2.5f, 3.0f, 3.5f};
+// Grid azimuth sectors
+constexpr int starGridAz = 8;
+// Grid polar bands
+constexpr int starGridPol = 4;
+// Grid cell count
+constexpr int starGridCells = starGridAz * starGridPol;
+
+// Star cell
+struct StarCell {
+    // Range start
+    int start = 0;
+    // Range count
+    int count = 0;
+    // Bound center
+    float cx = 0.f, cy = 0.f, cz = 0.f;
+    // Bound radius
+    float radius = 0.f;
+};
+
+// Bucket cells
+std::vector<StarCell> gStarCells[starBucketCount];
+// Star position buffer
+GLuint gStarPosVbo = 0;
+// Star colour buffers
+std::vector<float> gStarColorBuf[2];
+// Front buffer
+int gFrameFront = 0;
+// Sway yaw buffers
+float gSwayYaw[2] = {};
+// Sway pitch buffers
+float gSwayPitch[2] = {};
+// Task pending
+bool gFrameTaskPending = false;
+// Twinkle slices
+int gTwinkleSlices = 8;
+// Slice cursor
+int gTwinkleSlice = 0;
 
 
 // Triangle structure
@@ -183,10 +884,18 @@ struct Tri {
 };
 // Enterprise vertices
 std::vector<Vector> gEntVerts;
+// Enterprise normals
+std::vector<Vector> gEntNormals;
 // Enterprise triangles
 std::vector<Tri> gEntTris;
 // Enterprise scale
 float gEntScale = 1.0f;
+// Mesh vertex buffer
+GLuint gEntVbo = 0;
+// Mesh index buffer
+GLuint gEntIbo = 0;
+// Mesh index count
+GLsizei gEntIndexCount = 0;
 
 
 // Camera basis
@@ -257,8 +966,27 @@ static inline void integrateCamera(float dt) {
     }
 }
 
+// Cached colour
+float gMatRgb[3] = {-1.f, -1.f, -1.f};
+// Cached emission
+float gMatEmission = -1.f;
+
 // Set material
 static inline void setMaterial(const float rgb[3], float emission = 0.0f) {
+    // Check cache
+    if (rgb[0] == gMatRgb[0] && rgb[1] == gMatRgb[1] && rgb[2] == gMatRgb[2] &&
+        emission == gMatEmission) {
+        // Already applied
+        return;
+    }
+    // Cache colour
+    gMatRgb[0] = rgb[0];
+    // Cache green
+    gMatRgb[1] = rgb[1];
+    // Cache blue
+    gMatRgb[2] = rgb[2];
+    // Cache emission
+    gMatEmission = emission;
     // Diffuse colour
     const GLfloat diffuse[]  = { rgb[0], rgb[1], rgb[2], 1.0f };
     // Ambient colour
@@ -281,50 +1009,129 @@ static inline void setMaterial(const float rgb[3], float emission = 0.0f) {
     glMaterialfv(GL_FRONT_AND_BACK, GL_EMISSION, emissive);
 }
 
+// Build sphere cache
+static void initSphereCache() {
+    // Each LOD
+    for (int lod = 0; lod < sphereLodCount; ++lod) {
+        // Allocate list
+        gSphereLods[lod] = glGenLists(1);
+        // Record list
+        glNewList(gSphereLods[lod], GL_COMPILE);
+        // Tessellate unit sphere
+        gluSphere(gQuad, 1.0, sphereLodSlices[lod], sphereLodStacks[lod]);
+        // Finish list
+        glEndList();
+    }
+}
+
+// Select LOD
+static inline int sphereLodIndex(float r, Vector worldPos) {
+    // Camera offset
+    const Vector off = sub(worldPos, gCamPos);
+    // Camera distance
+    const float dist = std::sqrt(dot(off, off));
+    // Check proximity
+    if (dist < 1e-3f) {
+        // Full detail
+        return sphereLodCount - 1;
+    }
+    // Projected pixels
+    const float pixels = r * gPixelsPerUnit / dist;
+    // Tiny body
+    if (pixels < 6.f) {
+        // Coarse mesh
+        return 0;
+    }
+    // Small body
+    if (pixels < 40.f) {
+        // Medium mesh
+        return std::min(1, sphereLodCount - 1 - gQualityLevel);
+    }
+    // Capped detail
+    return sphereLodCount - 1 - gQualityLevel;
+}
+
 // Draw sphere
-static inline void drawSphere(float r, const float rgb[3], float emission = 0.0f) {
+static inline void drawSphere(float r, const float rgb[3], float emission = 0.0f,
+                              Vector worldPos = {0, 0, 0}) {
     // Apply material
     setMaterial(rgb, emission);
-    // Render sphere
-    gluSphere(gQuad, r, 36, 24);
+    // Save matrix
+    glPushMatrix();
+    // Scale instance
+    glScalef(r, r, r);
+    // Replay cached sphere
+    glCallList(gSphereLods[sphereLodIndex(r, worldPos)]);
+    // Restore matrix
+    glPopMatrix();
+}
+
+// Build ring
+static void buildOrbitRing(OrbitRing& ring, float rx, float rz, int segments, float y = 0.0f) {
+    // Ring vertices
+    std::vector<float> verts(segments * 3);
+
+    // Loop segments
+    for (int i = 0; i < segments; ++i) {
+        // Segment angle
+        const float a = float(i) / segments * 2.f * PI;
+        // Vertex x
+        verts[i*3 + 0] = rx * std::cos(a);
+        // Vertex y
+        verts[i*3 + 1] = y;
+        // Vertex z
+        verts[i*3 + 2] = rz * std::sin(a);
+    }
+
+    // Save count
+    ring.count = (GLsizei)segments;
+    // Create buffer
+    if (ring.vbo == 0) {
+        // Generate buffer
+        glGenBuffers(1, &ring.vbo);
+    }
+    // Bind buffer
+    glBindBuffer(GL_ARRAY_BUFFER, ring.vbo);
+    // Upload vertices
+    glBufferData(GL_ARRAY_BUFFER, verts.size() * sizeof(float), verts.data(), GL_STATIC_DRAW);
+    // Unbind buffer
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+// Build rings
+static void initOrbitRings() {
+    // Each planet
+    for (auto& p : gPlanets) {
+        // Planet ring
+        buildOrbitRing(p.ring, p.orbitRX, p.orbitRY, 256);
+        // Each moon
+        for (auto& m : p.moons) {
+            // Moon ring
+            buildOrbitRing(m.ring, m.orbitR, m.orbitR, 96);
+        }
+    }
 }
 
-// Draw orbit
-static inline void drawOrbitRingLines(float rx, float rz, int segments = 256, float y = 0.0f) {
+// Draw ring
+static inline void drawOrbitRing(const OrbitRing& ring) {
     // Disable lighting
     glDisable(GL_LIGHTING);
     // Line width
     glLineWidth(1.0f);
-    // Begin lines
-    glBegin(GL_LINES);
-
-    // Loop segments
-    for (int i = 0; i < segments; ++i) {
-        // Segment start
-        const float t0 = float(i) / segments;
-        // Segment end
-        const float t1 = float(i + 1) / segments;
-        // Start angle
-        const float a0 = t0 * 2.f * PI;
-        // End angle
-        const float a1 = t1 * 2.f * PI;
-        // Start x
-        const float x0 = rx * std::cos(a0);
-        // Start z
-        const float z0 = rz * std::sin(a0);
-        // End x
-        const float x1 = rx * std::cos(a1);
-        // End z
-        const float z1 = rz * std::sin(a1);
-
-        // First vertex
-        glVertex3f(x0, y, z0);
-        // Second vertex
-        glVertex3f(x1, y, z1);
-    }
-
-    // End lines
-    glEnd();
+    // Bind buffer
+    glBindBuffer(GL_ARRAY_BUFFER, ring.vbo);
+    // Enable positions
+    glEnableClientState(GL_VERTEX_ARRAY);
+    // Skip stride
+    const GLsizei stride = (GLsizei)(3 * sizeof(float)) << gQualityLevel;
+    // Position pointer
+    glVertexPointer(3, GL_FLOAT, stride, (const void*)0);
+    // Draw loop
+    glDrawArrays(GL_LINE_LOOP, 0, ring.count >> gQualityLevel);
+    // Disable positions
+    glDisableClientState(GL_VERTEX_ARRAY);
+    // Unbind buffer
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
     // Re-enable lighting
     glEnable(GL_LIGHTING);
 }
@@ -337,6 +1144,7 @@ static Moon makeMoon(float radius, float orbitR, float speed, float angle,
     moon.orbitR = orbitR;
     moon.speed  = speed;
     moon.angle  = angle;
+    moon.body   = -1;
     moon.colour[0] = r;
     moon.colour[1] = g;
     moon.colour[2] = b;
@@ -353,6 +1161,7 @@ static Planet makePlanet(float radius, float orbitRX, float orbitRY,
     planet.orbitRY = orbitRY;
     planet.speed = speed;
     planet.angle = angle;
+    planet.body = -1;
     planet.tilt = tilt;
     planet.colour[0] = r;
     planet.colour[1] = g;
@@ -402,150 +1211,1837 @@ static void initSystem() {
     gPlanets.push_back(planet6);
 }
 
+// Generator enabled
+bool gUseGenerator = false;
+// Generator seed
+std::uint64_t gGenSeed = 0;
+// Generator planets
+int gGenPlanetCount = 6;
 
-// Initialize stars
-static void initStars() {
-    // Clear stars
-    gStars.clear();
-    // Reserve space
-    gStars.reserve(starCount);
+// Generate system
+static void generateSystem(std::uint64_t seed, int planetCount) {
+    // Seed stream
+    seedRng(seed);
+    // Clear planets
+    gPlanets.clear();
+    // Reserve planets
+    gPlanets.reserve(planetCount);
 
-    // Generate stars
-    for (int i = 0; i < starCount; ++i) {
-        // Random u
-        const float u = frandRange(-1.f, 1.f);
-        // Random theta
-        const float th = frandRange(0.f, 2.f * PI);
-        // Random radius
-        const float r = frandRange(starMinR, starMaxR);
-        // Sphere mapping
-        const float s = std::sqrt(std::max(0.f, 1.f - u * u));
-        // Calculate x
-        const float x = r * s * std::cos(th);
-        // Calculate y
-        const float y = r * u;
-        // Calculate z
-        const float z = r * s * std::sin(th);
+    // Orbit cursor
+    float orbit = 9.f;
+    // Each planet
+    for (int i = 0; i < planetCount; ++i) {
+        // Planet radius
+        const float radius = frandRange(0.8f, 3.2f);
+        // Advance orbit
+        orbit += radius + frandRange(3.f, 7.f);
+        // Orbit eccentricity
+        const float rz = orbit * frandRange(0.8f, 1.0f);
+        // Orbit speed
+        const float speed = 380.f / orbit * frandRange(0.8f, 1.2f);
+        // Start angle
+        const float angle = frandRange(0.f, 360.f);
+        // Axis tilt
+        const float tilt = frandRange(0.f, 25.f);
+        // Planet red
+        const float r = frandRange(0.2f, 1.f);
+        // Planet green
+        const float g = frandRange(0.2f, 1.f);
+        // Planet blue
+        const float b = frandRange(0.2f, 1.f);
 
-        // Create star
-        Star st{};
-        // Set x
-        st.x = x;
-        // Set y
-        st.y = y;
-        // Set z
-        st.z = z;
-        // Random size
-        st.size = frandRange(1.5f, 3.5f);
-        // Red phase
-        st.phaseR = frandRange(0.f, 2.f * PI);
-        // Green phase
-        st.phaseG = frandRange(0.f, 2.f * PI);
-        // Blue phase
-        st.phaseB = frandRange(0.f, 2.f * PI);
-        // Twinkle speed
-        st.speed = frandRange(0.6f, 1.8f);
-        // Base brightness
-        st.base = frandRange(0.25f, 0.55f);
-        // Brightness change
-        st.amp = frandRange(0.35f, 0.75f);
+        // Create planet
+        Planet planet = makePlanet(radius, orbit, rz, speed, angle, tilt, r, g, b);
 
-        // Add star
-        gStars.push_back(st);
+        // Moon count
+        const int moonCount = int(frand01() * 3.f);
+        // Each moon
+        for (int m = 0; m < moonCount; ++m) {
+            // Moon radius
+            const float mr = frandRange(0.2f, 0.45f);
+            // Moon orbit
+            const float mo = radius + frandRange(1.2f, 3.6f) + m * 1.2f;
+            // Moon speed
+            const float ms = frandRange(40.f, 110.f);
+            // Moon angle
+            const float ma = frandRange(0.f, 360.f);
+            // Moon tint
+            const float mt = frandRange(0.75f, 1.f);
+            // Add moon
+            planet.moons.push_back(makeMoon(mr, mo, ms, ma, mt, mt, frandRange(0.85f, 1.f)));
+        }
+
+        // Store planet
+        gPlanets.push_back(planet);
     }
 }
 
-// Draw stars
-static void drawStars(double t) {
-    // Disable lighting
-    glDisable(GL_LIGHTING);
-    // Size buckets
-    const float buckets[] = {1.5f, 2.0f, 2.5f, 3.0f, 3.5f};
+// Cache freshness
+static bool binaryCacheFresh(const char* textPath, const char* binPath) {
+    // Text info
+    struct stat textInfo{};
+    // Binary info
+    struct stat binInfo{};
+    // Stat binary
+    if (stat(binPath, &binInfo) != 0) {
+        // No cache
+        return false;
+    }
+    // Stat text
+    if (stat(textPath, &textInfo) != 0) {
+        // Cache only
+        return true;
+    }
+    // Compare times
+    return binInfo.st_mtime >= textInfo.st_mtime;
+}
 
-    // Each size
-    for (float sz : buckets) {
-        // Set point size
-        glPointSize(sz);
-        // Begin points
-        glBegin(GL_POINTS);
-
-        // Each star
-        for (const auto& s : gStars) {
-            // Check size match
-            if (std::fabs(s.size - sz) > 0.3f) {
-                // Skip star
-                continue;
-            }
+// Scene enabled
+bool gUseSceneFile = false;
+// Scene path
+std::string gScenePath;
 
-            // Twinkle value
-            const float tw = s.base + s.amp * (0.5f * (std::sin(float(t) * s.speed + s.phaseR) + 1.0f)) * 0.9f;
-            // Red
-            const float r = std::min(1.f, std::max(0.f, tw * (0.6f + 0.4f * std::sin(float(t) * s.speed * 1.1f + s.phaseR))));
-            // Green
-            const float g = std::min(1.f, std::max(0.f, tw * (0.6f + 0.4f * std::sin(float(t) * s.speed * 0.9f + s.phaseG))));
-            // Blue
-            const float b = std::min(1.f, std::max(0.f, tw * (0.6f + 0.4f * std::sin(float(t) * s.speed * 1.3f + s.phaseB))));
+// Scene magic
+constexpr std::uint32_t sceneMagic = 0x4E435353u;
+// Scene version
+constexpr std::uint32_t sceneVersion = 1;
+// Star ceiling
+constexpr int sceneStarMax = 1 << 20;
 
-            // Set colour
-            glColor3f(r, g, b);
-            // Draw point
-            glVertex3f(s.x, s.y, s.z);
-        }
-        // End points
-        glEnd();
-    }
-    // Enable lighting
-    glEnable(GL_LIGHTING);
-}
+// Scene header
+struct SceneHeader {
+    // Magic word
+    std::uint32_t magic;
+    // Format version
+    std::uint32_t version;
+    // Planet count
+    std::uint32_t planetCount;
+    // Moon total
+    std::uint32_t moonCount;
+    // Star count
+    std::uint32_t starCount;
+    // Star radii
+    float starMinR, starMaxR;
+    // Camera start
+    float camX, camY, camZ;
+};
 
-// Load Enterprise
-static bool loadEnterprise() {
-    // Clear vertices
-    gEntVerts.clear();
-    // Clear triangles
-    gEntTris.clear();
+// Planet record
+struct ScenePlanetRec {
+    // Planet shape
+    float radius, orbitRX, orbitRY;
+    // Planet motion
+    float speed, angle, tilt;
+    // Planet colour
+    float colour[3];
+    // Moon count
+    std::uint32_t moonCount;
+};
 
+// Moon record
+struct SceneMoonRec {
+    // Moon shape
+    float radius, orbitR;
+    // Moon motion
+    float speed, angle;
+    // Moon colour
+    float colour[3];
+};
+
+// Parse scene
+static bool parseSceneText(const char* path) {
     // Open file
-    std::ifstream in("enterprise.txt");
+    std::ifstream in(path);
+    // Check open
+    if (!in) {
+        // No file
+        return false;
+    }
+
+    // Clear planets
+    gPlanets.clear();
     // Line buffer
     std::string line;
 
     // Read lines
     while (std::getline(in, line)) {
         // Check empty
-        if (line.empty()) {
+        if (line.empty() || line[0] == '#') {
             // Skip line
             continue;
         }
 
         // Parse line
         std::istringstream ss(line);
-        // Line type
-        char type;
-        // Read type
-        ss >> type;
+        // Line keyword
+        std::string key;
+        // Read keyword
+        ss >> key;
 
-        // Vertex line
-        if (type == 'v') {
-            // Create vertex
-            Vector v{};
-            // Read coordinates
-            ss >> v.x >> v.y >> v.z;
-            // Add vertex
-            gEntVerts.push_back(v);
+        // Camera line
+        if (key == "camera") {
+            // Read position
+            ss >> gCamPos.x >> gCamPos.y >> gCamPos.z;
+            // Sync previous
+            gCamPrevPos = gCamPos;
         }
-        // Face line
-        else if (type == 'f') {
-            // Create triangle
-            Tri t{};
-            // Read indices
-            ss >> t.a >> t.b >> t.c;
-            // Add triangle
-            gEntTris.push_back(t);
+        // Stars line
+        else if (key == "stars") {
+            // Star fields
+            int count = 0;
+            // Radius fields
+            float minR = 0.f, maxR = 0.f;
+            // Read parameters
+            ss >> count >> minR >> maxR;
+            // Check line
+            if (ss) {
+                // Clamp count
+                gStarCount = std::min(std::max(0, count), sceneStarMax);
+                // Clamp minimum
+                gStarMinR = std::max(1.f, minR);
+                // Clamp maximum
+                gStarMaxR = std::max(gStarMinR, maxR);
+            }
+        }
+        // Planet line
+        else if (key == "planet") {
+            // Planet fields
+            float radius = 0.f, rx = 0.f, rz = 0.f, speed = 0.f, angle = 0.f, tilt = 0.f;
+            // Colour fields
+            float r = 0.f, g = 0.f, b = 0.f;
+            // Read fields
+            ss >> radius >> rx >> rz >> speed >> angle >> tilt >> r >> g >> b;
+            // Check line
+            if (ss) {
+                // Add planet
+                gPlanets.push_back(makePlanet(radius, rx, rz, speed, angle, tilt, r, g, b));
+            }
+        }
+        // Moon line
+        else if (key == "moon" && !gPlanets.empty()) {
+            // Moon fields
+            float radius = 0.f, orbitR = 0.f, speed = 0.f, angle = 0.f;
+            // Colour fields
+            float r = 0.f, g = 0.f, b = 0.f;
+            // Read fields
+            ss >> radius >> orbitR >> speed >> angle >> r >> g >> b;
+            // Check line
+            if (ss) {
+                // Add moon
+                gPlanets.back().moons.push_back(makeMoon(radius, orbitR, speed, angle, r, g, b));
+            }
         }
     }
 
-    // Minimum bounds
+    // Check content
+    return !gPlanets.empty();
+}
+
+// Load scene binary
+static bool loadSceneBinary(const char* path) {
+    // Open file
+    const int fd = open(path, O_RDONLY);
+    // Check open
+    if (fd < 0) {
+        // No file
+        return false;
+    }
+
+    // File info
+    struct stat info{};
+    // Stat file
+    if (fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(SceneHeader)) {
+        // Close file
+        close(fd);
+        // Bad file
+        return false;
+    }
+
+    // Map file
+    void* base = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // Check mapping
+    if (base == MAP_FAILED) {
+        // Close file
+        close(fd);
+        // No mapping
+        return false;
+    }
+
+    // Read header
+    SceneHeader header{};
+    // Copy header
+    std::memcpy(&header, base, sizeof(header));
+
+    // Expected size
+    const size_t expected = sizeof(header)
+                          + header.planetCount * sizeof(ScenePlanetRec)
+                          + header.moonCount * sizeof(SceneMoonRec);
+    // Validate header
+    if (header.magic != sceneMagic || header.version != sceneVersion ||
+        (size_t)info.st_size < expected) {
+        // Unmap file
+        munmap(base, (size_t)info.st_size);
+        // Close file
+        close(fd);
+        // Stale cache
+        return false;
+    }
+
+    // Validate stars
+    if (header.starCount > (std::uint32_t)sceneStarMax ||
+        !(header.starMinR > 0.f) || !(header.starMaxR >= header.starMinR)) {
+        // Unmap file
+        munmap(base, (size_t)info.st_size);
+        // Close file
+        close(fd);
+        // Corrupt cache
+        return false;
+    }
+
+    // Restore stars
+    gStarCount = (int)header.starCount;
+    // Restore minimum
+    gStarMinR = header.starMinR;
+    // Restore maximum
+    gStarMaxR = header.starMaxR;
+    // Restore camera
+    gCamPos = Vector{header.camX, header.camY, header.camZ};
+    // Sync previous
+    gCamPrevPos = gCamPos;
+
+    // Record cursor
+    const char* src = (const char*)base + sizeof(header);
+    // Clear planets
+    gPlanets.clear();
+    // Reserve planets
+    gPlanets.reserve(header.planetCount);
+    // Moons consumed
+    std::uint32_t moonsSeen = 0;
+
+    // Each planet
+    for (std::uint32_t i = 0; i < header.planetCount; ++i) {
+        // Planet record
+        ScenePlanetRec rec{};
+        // Copy record
+        std::memcpy(&rec, src, sizeof(rec));
+        // Advance cursor
+        src += sizeof(rec);
+
+        // Validate moons
+        if (rec.moonCount > header.moonCount - moonsSeen) {
+            // Drop partial
+            gPlanets.clear();
+            // Unmap file
+            munmap(base, (size_t)info.st_size);
+            // Close file
+            close(fd);
+            // Corrupt cache
+            return false;
+        }
+        // Consume moons
+        moonsSeen += rec.moonCount;
+
+        // Build planet
+        Planet planet = makePlanet(rec.radius, rec.orbitRX, rec.orbitRY, rec.speed,
+                                   rec.angle, rec.tilt, rec.colour[0], rec.colour[1], rec.colour[2]);
+        // Each moon
+        for (std::uint32_t m = 0; m < rec.moonCount; ++m) {
+            // Moon record
+            SceneMoonRec mrec{};
+            // Copy record
+            std::memcpy(&mrec, src, sizeof(mrec));
+            // Advance cursor
+            src += sizeof(mrec);
+            // Build moon
+            planet.moons.push_back(makeMoon(mrec.radius, mrec.orbitR, mrec.speed, mrec.angle,
+                                            mrec.colour[0], mrec.colour[1], mrec.colour[2]));
+        }
+        // Store planet
+        gPlanets.push_back(planet);
+    }
+
+    // Unmap file
+    munmap(base, (size_t)info.st_size);
+    // Close file
+    close(fd);
+    // Success
+    return true;
+}
+
+// Save scene binary
+static void saveSceneBinary(const char* path) {
+    // Open file
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    // Check open
+    if (!out) {
+        // Skip cache
+        return;
+    }
+
+    // Moon total
+    std::uint32_t moonTotal = 0;
+    // Each planet
+    for (const auto& p : gPlanets) {
+        // Count moons
+        moonTotal += (std::uint32_t)p.moons.size();
+    }
+
+    // Build header
+    SceneHeader header{};
+    // Set magic
+    header.magic = sceneMagic;
+    // Set version
+    header.version = sceneVersion;
+    // Set planets
+    header.planetCount = (std::uint32_t)gPlanets.size();
+    // Set moons
+    header.moonCount = moonTotal;
+    // Set stars
+    header.starCount = (std::uint32_t)gStarCount;
+    // Set minimum
+    header.starMinR = gStarMinR;
+    // Set maximum
+    header.starMaxR = gStarMaxR;
+    // Set camera x
+    header.camX = gCamPos.x;
+    // Set camera y
+    header.camY = gCamPos.y;
+    // Set camera z
+    header.camZ = gCamPos.z;
+    // Write header
+    out.write((const char*)&header, sizeof(header));
+
+    // Each planet
+    for (const auto& p : gPlanets) {
+        // Planet record
+        ScenePlanetRec rec{};
+        // Copy radius
+        rec.radius = p.radius;
+        // Copy X radius
+        rec.orbitRX = p.orbitRX;
+        // Copy Z radius
+        rec.orbitRY = p.orbitRY;
+        // Copy speed
+        rec.speed = p.speed;
+        // Copy angle
+        rec.angle = p.angle;
+        // Copy tilt
+        rec.tilt = p.tilt;
+        // Copy colour
+        std::memcpy(rec.colour, p.colour, sizeof(rec.colour));
+        // Copy moons
+        rec.moonCount = (std::uint32_t)p.moons.size();
+        // Write record
+        out.write((const char*)&rec, sizeof(rec));
+
+        // Each moon
+        for (const auto& m : p.moons) {
+            // Moon record
+            SceneMoonRec mrec{};
+            // Copy radius
+            mrec.radius = m.radius;
+            // Copy orbit
+            mrec.orbitR = m.orbitR;
+            // Copy speed
+            mrec.speed = m.speed;
+            // Copy angle
+            mrec.angle = m.angle;
+            // Copy colour
+            std::memcpy(mrec.colour, m.colour, sizeof(mrec.colour));
+            // Write record
+            out.write((const char*)&mrec, sizeof(mrec));
+        }
+    }
+}
+
+// Load scene
+static bool loadScene(const std::string& path) {
+    // Cache path
+    const std::string binPath = path + ".bin";
+
+    // Try cache
+    if (binaryCacheFresh(path.c_str(), binPath.c_str()) && loadSceneBinary(binPath.c_str())) {
+        // Cache hit
+        return true;
+    }
+
+    // Parse text
+    if (!parseSceneText(path.c_str())) {
+        // Parse failed
+        return false;
+    }
+
+    // Write cache
+    saveSceneBinary(binPath.c_str());
+    // Success
+    return true;
+}
+
+// Add body
+static int addBody(float angle, float speed, float rx, float rz, int parent) {
+    // New slot
+    const int body = (int)gBodyAngle.size();
+    // Store angle
+    gBodyAngle.push_back(angle);
+    // Store previous
+    gBodyPrevAngle.push_back(angle);
+    // Store speed
+    gBodySpeed.push_back(speed);
+    // Store X radius
+    gBodyOrbitRX.push_back(rx);
+    // Store Z radius
+    gBodyOrbitRZ.push_back(rz);
+    // Store parent
+    gBodyParent.push_back(parent);
+    // Reserve local X
+    gBodyLocalX.push_back(0.f);
+    // Reserve local Z
+    gBodyLocalZ.push_back(0.f);
+    // Reserve world X
+    gBodyPosX.push_back(0.f);
+    // Reserve world Z
+    gBodyPosZ.push_back(0.f);
+    // Slot index
+    return body;
+}
+
+// Build bodies
+static void initBodyState() {
+    // Clear angles
+    gBodyAngle.clear();
+    // Clear previous
+    gBodyPrevAngle.clear();
+    // Clear speeds
+    gBodySpeed.clear();
+    // Clear X radii
+    gBodyOrbitRX.clear();
+    // Clear Z radii
+    gBodyOrbitRZ.clear();
+    // Clear parents
+    gBodyParent.clear();
+    // Clear local X
+    gBodyLocalX.clear();
+    // Clear local Z
+    gBodyLocalZ.clear();
+    // Clear world X
+    gBodyPosX.clear();
+    // Clear world Z
+    gBodyPosZ.clear();
+
+    // Each planet
+    for (auto& p : gPlanets) {
+        // Planet slot
+        p.body = addBody(p.angle, p.speed, p.orbitRX, p.orbitRY, -1);
+        // Each moon
+        for (auto& m : p.moons) {
+            // Moon slot
+            m.body = addBody(m.angle, m.speed, m.orbitR, m.orbitR, p.body);
+        }
+    }
+}
+
+// Planet draw order
+std::vector<int> gPlanetDrawOrder;
+
+// Colour ordering
+static inline bool colourLess(const float* a, const float* b) {
+    // Compare red
+    if (a[0] != b[0]) return a[0] < b[0];
+    // Compare green
+    if (a[1] != b[1]) return a[1] < b[1];
+    // Compare blue
+    return a[2] < b[2];
+}
+
+// Build draw order
+static void initDrawOrder() {
+    // Size order
+    gPlanetDrawOrder.resize(gPlanets.size());
+    // Identity order
+    for (size_t i = 0; i < gPlanetDrawOrder.size(); ++i) {
+        // Own index
+        gPlanetDrawOrder[i] = (int)i;
+    }
+    // Sort planets
+    std::sort(gPlanetDrawOrder.begin(), gPlanetDrawOrder.end(), [](int a, int b) {
+        // Compare colours
+        return colourLess(gPlanets[a].colour, gPlanets[b].colour);
+    });
+    // Each planet
+    for (auto& p : gPlanets) {
+        // Sort moons
+        std::sort(p.moons.begin(), p.moons.end(), [](const Moon& a, const Moon& b) {
+            // Compare colours
+            return colourLess(a.colour, b.colour);
+        });
+    }
+}
+
+// Advance bodies
+static void advanceBodies(float dt) {
+    // Body count
+    const int n = (int)gBodyAngle.size();
+    // Angle array
+    float* angle = gBodyAngle.data();
+    // Previous array
+    float* prev = gBodyPrevAngle.data();
+    // Speed array
+    const float* speed = gBodySpeed.data();
+
+    // Bulk advance
+    for (int i = 0; i < n; ++i) {
+        // Save angle
+        prev[i] = angle[i];
+        // Step angle
+        float a = angle[i] + speed[i] * dt;
+        // Branchless wrap
+        a -= 360.f * float(a >= 360.f);
+        // Store angle
+        angle[i] = a;
+    }
+}
+
+// N-body mode
+bool gNBodyMode = false;
+// Gravity constant
+constexpr float gravityG = 0.35f;
+// Sun mass
+constexpr float sunMass = 4000.f;
+// Opening angle
+constexpr float bhTheta = 0.5f;
+// Softening length
+constexpr float bhSoftening = 0.25f;
+
+// Body masses
+std::vector<float> gBodyMass;
+// Body X velocity
+std::vector<float> gBodyVelX;
+// Body Z velocity
+std::vector<float> gBodyVelZ;
+// Body X acceleration
+std::vector<float> gBodyAccX;
+// Body Z acceleration
+std::vector<float> gBodyAccZ;
+// Physics X position
+std::vector<float> gBodyNX;
+// Physics Z position
+std::vector<float> gBodyNZ;
+// Previous X position
+std::vector<float> gBodyPrevNX;
+// Previous Z position
+std::vector<float> gBodyPrevNZ;
+// Acceleration cached
+bool gBodyAccValid = false;
+
+// Tree node
+struct BhNode {
+    // Cell centre
+    float cx, cz;
+    // Half extent
+    float half;
+    // Node mass
+    float mass;
+    // Mass centre
+    float comX, comZ;
+    // Child nodes
+    int child[4];
+    // Leaf body
+    int body;
+};
+
+// Node pool
+std::vector<BhNode> gBhNodes;
+
+// Allocate node
+static int bhNewNode(float cx, float cz, float half) {
+    // New node
+    BhNode node;
+    // Cell x
+    node.cx = cx;
+    // Cell z
+    node.cz = cz;
+    // Cell extent
+    node.half = half;
+    // Empty mass
+    node.mass = 0.f;
+    // Empty centre x
+    node.comX = 0.f;
+    // Empty centre z
+    node.comZ = 0.f;
+    // No children
+    node.child[0] = node.child[1] = node.child[2] = node.child[3] = -1;
+    // No body
+    node.body = -1;
+    // Pool slot
+    gBhNodes.push_back(node);
+    // Slot index
+    return (int)gBhNodes.size() - 1;
+}
+
+// Child quadrant
+static inline int bhQuadrant(const BhNode& node, float x, float z) {
+    // Quadrant bits
+    return (x >= node.cx ? 1 : 0) | (z >= node.cz ? 2 : 0);
+}
+
+// Insert body
+static void bhInsert(int node, int body) {
+    // Body x
+    const float x = gBodyNX[body];
+    // Body z
+    const float z = gBodyNZ[body];
+    // Body mass
+    const float m = gBodyMass[body];
+
+    // Walk down
+    while (true) {
+        // Fold scope
+        {
+            // Current node
+            BhNode& n = gBhNodes[node];
+            // Fold mass
+            const float total = n.mass + m;
+            // Fold centre x
+            n.comX = (n.comX * n.mass + x * m) / total;
+            // Fold centre z
+            n.comZ = (n.comZ * n.mass + z * m) / total;
+            // Store mass
+            n.mass = total;
+        }
+
+        // Cell centre x
+        const float cx = gBhNodes[node].cx;
+        // Cell centre z
+        const float cz = gBhNodes[node].cz;
+        // Cell extent
+        const float half = gBhNodes[node].half;
+        // Internal node
+        const bool internal = gBhNodes[node].child[0] >= 0 || gBhNodes[node].child[1] >= 0 ||
+                              gBhNodes[node].child[2] >= 0 || gBhNodes[node].child[3] >= 0;
+
+        // Leaf node
+        if (!internal) {
+            // Empty leaf
+            if (gBhNodes[node].body < 0) {
+                // Claim leaf
+                gBhNodes[node].body = body;
+                // Done
+                return;
+            }
+            // Degenerate cell
+            if (half < 1e-4f) {
+                // Merge bodies
+                return;
+            }
+            // Occupied leaf
+            const int other = gBhNodes[node].body;
+            // Clear leaf
+            gBhNodes[node].body = -1;
+            // Other quadrant
+            const int oq = bhQuadrant(gBhNodes[node], gBodyNX[other], gBodyNZ[other]);
+            // Child extent
+            const float oh = half * 0.5f;
+            // Other child
+            const int oc = bhNewNode(cx + (oq & 1 ? oh : -oh), cz + (oq & 2 ? oh : -oh), oh);
+            // Attach child
+            gBhNodes[node].child[oq] = oc;
+            // Reinsert other
+            bhInsert(oc, other);
+        }
+
+        // Pick quadrant
+        const int q = bhQuadrant(gBhNodes[node], x, z);
+        // Missing child
+        if (gBhNodes[node].child[q] < 0) {
+            // Child extent
+            const float h = half * 0.5f;
+            // Child slot
+            const int c = bhNewNode(cx + (q & 1 ? h : -h), cz + (q & 2 ? h : -h), h);
+            // Attach child
+            gBhNodes[node].child[q] = c;
+        }
+        // Descend tree
+        node = gBhNodes[node].child[q];
+    }
+}
+
+// Build tree
+static void buildBhTree() {
+    // Reset pool
+    gBhNodes.clear();
+    // Body count
+    const int n = (int)gBodyNX.size();
+    // Check empty
+    if (n == 0) {
+        // No tree
+        return;
+    }
+
+    // Root extent
+    float extent = 1.f;
+    // Each body
+    for (int i = 0; i < n; ++i) {
+        // Widen extent
+        extent = std::max(extent, std::max(std::fabs(gBodyNX[i]), std::fabs(gBodyNZ[i])));
+    }
+    // Root node
+    bhNewNode(0.f, 0.f, extent * 1.01f);
+    // Each body
+    for (int i = 0; i < n; ++i) {
+        // Insert body
+        bhInsert(0, i);
+    }
+}
+
+// Walk tree
+static void bhAccumulate(int node, int body, float& ax, float& az) {
+    // Current node
+    const BhNode& n = gBhNodes[node];
+    // Offset x
+    float dx = n.comX - gBodyNX[body];
+    // Offset z
+    float dz = n.comZ - gBodyNZ[body];
+    // Squared distance
+    const float d2 = dx*dx + dz*dz + bhSoftening*bhSoftening;
+    // True distance
+    const float d = std::sqrt(d2);
+
+    // Far cell
+    if (n.body == body) {
+        // Skip self
+        return;
+    }
+    // Opening test
+    if (n.body >= 0 || (2.f * n.half) / d < bhTheta) {
+        // Inverse cube
+        const float inv = gravityG * n.mass / (d2 * d);
+        // Pull x
+        ax += dx * inv;
+        // Pull z
+        az += dz * inv;
+        // Done
+        return;
+    }
+
+    // Each child
+    for (int q = 0; q < 4; ++q) {
+        // Check child
+        if (n.child[q] >= 0) {
+            // Recurse child
+            bhAccumulate(n.child[q], body, ax, az);
+        }
+    }
+}
+
+// Compute accelerations
+static void nbodyAccelerations() {
+    // Rebuild tree
+    buildBhTree();
+    // Body count
+    const int n = (int)gBodyNX.size();
+    // Each body
+    for (int i = 0; i < n; ++i) {
+        // Sun offset x
+        const float dx = -gBodyNX[i];
+        // Sun offset z
+        const float dz = -gBodyNZ[i];
+        // Sun distance
+        const float d2 = dx*dx + dz*dz + bhSoftening*bhSoftening;
+        // Sun distance
+        const float d = std::sqrt(d2);
+        // Sun pull
+        const float inv = gravityG * sunMass / (d2 * d);
+        // Pull x
+        float ax = dx * inv;
+        // Pull z
+        float az = dz * inv;
+        // Tree pull
+        bhAccumulate(0, i, ax, az);
+        // Store x
+        gBodyAccX[i] = ax;
+        // Store z
+        gBodyAccZ[i] = az;
+    }
+}
+
+// Enter mode
+static void enterNBodyMode() {
+    // Body count
+    const int n = (int)gBodyAngle.size();
+    // Size masses
+    gBodyMass.assign(n, 0.f);
+    // Size X velocities
+    gBodyVelX.assign(n, 0.f);
+    // Size Z velocities
+    gBodyVelZ.assign(n, 0.f);
+    // Size X accelerations
+    gBodyAccX.assign(n, 0.f);
+    // Size Z accelerations
+    gBodyAccZ.assign(n, 0.f);
+    // Size X positions
+    gBodyNX.assign(n, 0.f);
+    // Size Z positions
+    gBodyNZ.assign(n, 0.f);
+
+    // Each body
+    for (int i = 0; i < n; ++i) {
+        // Current angle
+        const float a = deg2rad(gBodyAngle[i]);
+        // Angular rate
+        const float w = deg2rad(gBodySpeed[i]);
+        // Local x
+        gBodyNX[i] = gBodyOrbitRX[i] * std::cos(a);
+        // Local z
+        gBodyNZ[i] = gBodyOrbitRZ[i] * std::sin(a);
+        // Local x velocity
+        gBodyVelX[i] = -gBodyOrbitRX[i] * std::sin(a) * w;
+        // Local z velocity
+        gBodyVelZ[i] = gBodyOrbitRZ[i] * std::cos(a) * w;
+    }
+
+    // Resolve parents
+    for (int i = 0; i < n; ++i) {
+        // Check parent
+        if (gBodyParent[i] >= 0) {
+            // Offset x
+            gBodyNX[i] += gBodyNX[gBodyParent[i]];
+            // Offset z
+            gBodyNZ[i] += gBodyNZ[gBodyParent[i]];
+            // Carry x velocity
+            gBodyVelX[i] += gBodyVelX[gBodyParent[i]];
+            // Carry z velocity
+            gBodyVelZ[i] += gBodyVelZ[gBodyParent[i]];
+        }
+    }
+
+    // Planet masses
+    for (const auto& p : gPlanets) {
+        // Volume mass
+        gBodyMass[p.body] = p.radius * p.radius * p.radius;
+        // Each moon
+        for (const auto& m : p.moons) {
+            // Volume mass
+            gBodyMass[m.body] = m.radius * m.radius * m.radius;
+        }
+    }
+
+    // Seed previous x
+    gBodyPrevNX = gBodyNX;
+    // Seed previous z
+    gBodyPrevNZ = gBodyNZ;
+    // Invalidate cache
+    gBodyAccValid = false;
+}
+
+// Physics step
+static void nbodyStep(float dt) {
+    // Body count
+    const int n = (int)gBodyNX.size();
+    // Warm cache
+    if (!gBodyAccValid) {
+        // Initial forces
+        nbodyAccelerations();
+        // Cache valid
+        gBodyAccValid = true;
+    }
+
+    // Save previous
+    gBodyPrevNX = gBodyNX;
+    // Save previous
+    gBodyPrevNZ = gBodyNZ;
+
+    // Leapfrog kick
+    for (int i = 0; i < n; ++i) {
+        // Half kick x
+        gBodyVelX[i] += 0.5f * gBodyAccX[i] * dt;
+        // Half kick z
+        gBodyVelZ[i] += 0.5f * gBodyAccZ[i] * dt;
+        // Drift x
+        gBodyNX[i] += gBodyVelX[i] * dt;
+        // Drift z
+        gBodyNZ[i] += gBodyVelZ[i] * dt;
+    }
+
+    // New forces
+    nbodyAccelerations();
+
+    // Leapfrog kick
+    for (int i = 0; i < n; ++i) {
+        // Half kick x
+        gBodyVelX[i] += 0.5f * gBodyAccX[i] * dt;
+        // Half kick z
+        gBodyVelZ[i] += 0.5f * gBodyAccZ[i] * dt;
+    }
+}
+
+// Trail capacity
+constexpr int trailCapacity = 96;
+// Trail period
+constexpr float trailSampleDt = 0.05f;
+// Show trails
+bool gShowTrails = false;
+// Trail X history
+std::vector<float> gTrailX;
+// Trail Z history
+std::vector<float> gTrailZ;
+// Trail head
+int gTrailHead = 0;
+// Trail fill
+int gTrailCount = 0;
+// Sample accumulator
+float gTrailAccum = 0.f;
+
+// Allocate trails
+static void initTrails() {
+    // Body count
+    const int n = (int)gBodyAngle.size();
+    // Size X history
+    gTrailX.assign((size_t)n * trailCapacity, 0.f);
+    // Size Z history
+    gTrailZ.assign((size_t)n * trailCapacity, 0.f);
+    // Reset head
+    gTrailHead = 0;
+    // Reset fill
+    gTrailCount = 0;
+    // Reset accumulator
+    gTrailAccum = 0.f;
+}
+
+
+// Frustum plane
+struct Plane {
+    // Plane coefficients
+    float a, b, c, d;
+};
+
+// View frustum
+Plane gFrustum[6];
+
+// Extract frustum
+static void extractFrustum() {
+    // Projection matrix
+    float proj[16];
+    // Modelview matrix
+    float model[16];
+    // Combined matrix
+    float clip[16];
+    // Read projection
+    glGetFloatv(GL_PROJECTION_MATRIX, proj);
+    // Read modelview
+    glGetFloatv(GL_MODELVIEW_MATRIX, model);
+
+    // Each column
+    for (int c = 0; c < 4; ++c) {
+        // Each row
+        for (int r = 0; r < 4; ++r) {
+            // Dot accumulator
+            float sum = 0.f;
+            // Multiply row
+            for (int k = 0; k < 4; ++k) {
+                // Accumulate product
+                sum += model[c*4 + k] * proj[k*4 + r];
+            }
+            // Store element
+            clip[c*4 + r] = sum;
+        }
+    }
+
+    // Each plane
+    for (int i = 0; i < 6; ++i) {
+        // Source row
+        const int row = i / 2;
+        // Row sign
+        const float sign = (i % 2 == 0) ? 1.f : -1.f;
+        // Plane reference
+        Plane& pl = gFrustum[i];
+        // Coefficient a
+        pl.a = clip[3]  + sign * clip[row];
+        // Coefficient b
+        pl.b = clip[7]  + sign * clip[4 + row];
+        // Coefficient c
+        pl.c = clip[11] + sign * clip[8 + row];
+        // Coefficient d
+        pl.d = clip[15] + sign * clip[12 + row];
+        // Plane length
+        const float len = std::sqrt(pl.a*pl.a + pl.b*pl.b + pl.c*pl.c);
+        // Check length
+        if (len > 1e-6f) {
+            // Normalize a
+            pl.a /= len;
+            // Normalize b
+            pl.b /= len;
+            // Normalize c
+            pl.c /= len;
+            // Normalize d
+            pl.d /= len;
+        }
+    }
+}
+
+// Sphere visibility
+static inline bool sphereInFrustum(float x, float y, float z, float r) {
+    // Each plane
+    for (const Plane& pl : gFrustum) {
+        // Signed distance
+        if (pl.a*x + pl.b*y + pl.c*z + pl.d < -r) {
+            // Outside plane
+            return false;
+        }
+    }
+    // Inside frustum
+    return true;
+}
+
+// Star bucket
+static inline int starBucketIndex(float size) {
+    // Best bucket
+    int best = 0;
+    // Best distance
+    float bestDist = std::fabs(size - starBucketSizes[0]);
+    // Each bucket
+    for (int bkt = 1; bkt < starBucketCount; ++bkt) {
+        // Bucket distance
+        const float dist = std::fabs(size - starBucketSizes[bkt]);
+        // Closer bucket
+        if (dist < bestDist) {
+            // Update best
+            best = bkt;
+            // Update distance
+            bestDist = dist;
+        }
+    }
+    // Nearest bucket
+    return best;
+}
+
+// Star shader
+GLuint gStarProgram = 0;
+// Time uniform
+GLint gStarTimeLoc = -1;
+// Attribute buffer
+GLuint gStarAttrVbo = 0;
+// Shader usable
+bool gStarShaderReady = false;
+
+// Twinkle vertex shader
+const char* starVertexSrc =
+    "uniform float uTime;\n"
+    "attribute vec3 aPhase;\n"
+    "attribute vec3 aParams;\n"
+    "varying vec3 vColor;\n"
+    "void main() {\n"
+    "    float t = uTime * aParams.x;\n"
+    "    float tw = aParams.y + aParams.z * (0.5 * (sin(t + aPhase.x) + 1.0)) * 0.9;\n"
+    "    vec3 s = vec3(sin(t * 1.1 + aPhase.x),\n"
+    "                  sin(t * 0.9 + aPhase.y),\n"
+    "                  sin(t * 1.3 + aPhase.z));\n"
+    "    vColor = clamp(tw * (0.6 + 0.4 * s), 0.0, 1.0);\n"
+    "    gl_Position = gl_ModelViewProjectionMatrix * gl_Vertex;\n"
+    "}\n";
+
+// Twinkle fragment shader
+const char* starFragmentSrc =
+    "varying vec3 vColor;\n"
+    "void main() {\n"
+    "    gl_FragColor = vec4(vColor, 1.0);\n"
+    "}\n";
+
+// Compile shader
+static GLuint compileShader(GLenum type, const char* src) {
+    // Create shader
+    const GLuint shader = glCreateShader(type);
+    // Attach source
+    glShaderSource(shader, 1, &src, nullptr);
+    // Compile source
+    glCompileShader(shader);
+    // Compile status
+    GLint status = GL_FALSE;
+    // Query status
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    // Check failure
+    if (status != GL_TRUE) {
+        // Log buffer
+        char log[512];
+        // Fetch log
+        glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+        // Report failure
+        std::printf("shader: compile failed: %s\n", log);
+        // Destroy shader
+        glDeleteShader(shader);
+        // No shader
+        return 0;
+    }
+    // Compiled shader
+    return shader;
+}
+
+// Build star shader
+static void initStarShader() {
+    // Vertex shader
+    const GLuint vs = compileShader(GL_VERTEX_SHADER, starVertexSrc);
+    // Fragment shader
+    const GLuint fs = compileShader(GL_FRAGMENT_SHADER, starFragmentSrc);
+    // Check shaders
+    if (vs == 0 || fs == 0) {
+        // CPU fallback
+        return;
+    }
+
+    // Create program
+    gStarProgram = glCreateProgram();
+    // Attach vertex
+    glAttachShader(gStarProgram, vs);
+    // Attach fragment
+    glAttachShader(gStarProgram, fs);
+    // Phase location
+    glBindAttribLocation(gStarProgram, 1, "aPhase");
+    // Params location
+    glBindAttribLocation(gStarProgram, 2, "aParams");
+    // Link program
+    glLinkProgram(gStarProgram);
+    // Release vertex
+    glDeleteShader(vs);
+    // Release fragment
+    glDeleteShader(fs);
+
+    // Link status
+    GLint status = GL_FALSE;
+    // Query status
+    glGetProgramiv(gStarProgram, GL_LINK_STATUS, &status);
+    // Check failure
+    if (status != GL_TRUE) {
+        // Log buffer
+        char log[512];
+        // Fetch log
+        glGetProgramInfoLog(gStarProgram, sizeof(log), nullptr, log);
+        // Report failure
+        std::printf("shader: link failed: %s\n", log);
+        // Destroy program
+        glDeleteProgram(gStarProgram);
+        // Clear handle
+        gStarProgram = 0;
+        // CPU fallback
+        return;
+    }
+
+    // Time uniform
+    gStarTimeLoc = glGetUniformLocation(gStarProgram, "uTime");
+    // Mark usable
+    gStarShaderReady = true;
+}
+
+// Upload star attributes
+static void uploadStarAttributes() {
+    // Attribute data
+    float* attrs = arenaAllocT<float>(gLoadArena, gStars.size() * 6);
+    // Each star
+    for (size_t i = 0; i < gStars.size(); ++i) {
+        // Red phase
+        attrs[i*6 + 0] = gStars[i].phaseR;
+        // Green phase
+        attrs[i*6 + 1] = gStars[i].phaseG;
+        // Blue phase
+        attrs[i*6 + 2] = gStars[i].phaseB;
+        // Twinkle speed
+        attrs[i*6 + 3] = gStars[i].speed;
+        // Base brightness
+        attrs[i*6 + 4] = gStars[i].base;
+        // Brightness amplitude
+        attrs[i*6 + 5] = gStars[i].amp;
+    }
+    // Create buffer
+    if (gStarAttrVbo == 0) {
+        // Generate buffer
+        glGenBuffers(1, &gStarAttrVbo);
+    }
+    // Bind buffer
+    glBindBuffer(GL_ARRAY_BUFFER, gStarAttrVbo);
+    // Upload attributes
+    glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)(gStars.size() * 6 * sizeof(float)), attrs, GL_STATIC_DRAW);
+    // Unbind buffer
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    // Recycle scratch
+    arenaReset(gLoadArena);
+}
+
+// Star cell index
+static inline int starGridCell(const Star& s) {
+    // Star radius
+    const float r = std::sqrt(s.x*s.x + s.y*s.y + s.z*s.z);
+    // Degenerate star
+    if (r < 1e-6f) {
+        // First cell
+        return 0;
+    }
+    // Azimuth angle
+    const float az = std::atan2(s.z, s.x) + PI;
+    // Azimuth sector
+    const int sector = std::min(starGridAz - 1, int(az / (2.f * PI) * starGridAz));
+    // Polar fraction
+    const float u = (s.y / r + 1.f) * 0.5f;
+    // Polar band
+    const int band = std::min(starGridPol - 1, int(u * starGridPol));
+    // Cell index
+    return sector * starGridPol + band;
+}
+
+// Initialize stars
+static void initStars() {
+    // Clear stars
+    gStars.clear();
+    // Reserve space
+    gStars.reserve(gStarCount);
+
+    // Generate stars
+    for (int i = 0; i < gStarCount; ++i) {
+        // Random u
+        const float u = frandRange(-1.f, 1.f);
+        // Random theta
+        const float th = frandRange(0.f, 2.f * PI);
+        // Random radius
+        const float r = frandRange(gStarMinR, gStarMaxR);
+        // Sphere mapping
+        const float s = std::sqrt(std::max(0.f, 1.f - u * u));
+        // Calculate x
+        const float x = r * s * std::cos(th);
+        // Calculate y
+        const float y = r * u;
+        // Calculate z
+        const float z = r * s * std::sin(th);
+
+        // Create star
+        Star st{};
+        // Set x
+        st.x = x;
+        // Set y
+        st.y = y;
+        // Set z
+        st.z = z;
+        // Random size
+        st.size = frandRange(1.5f, 3.5f);
+        // Red phase
+        st.phaseR = frandRange(0.f, 2.f * PI);
+        // Green phase
+        st.phaseG = frandRange(0.f, 2.f * PI);
+        // Blue phase
+        st.phaseB = frandRange(0.f, 2.f * PI);
+        // Twinkle speed
+        st.speed = frandRange(0.6f, 1.8f);
+        // Base brightness
+        st.base = frandRange(0.25f, 0.55f);
+        // Brightness change
+        st.amp = frandRange(0.35f, 0.75f);
+
+        // Add star
+        gStars.push_back(st);
+    }
+
+    // Sort cells
+    std::sort(gStars.begin(), gStars.end(), [](const Star& a, const Star& b) {
+        // Bucket key a
+        const int ba = starBucketIndex(a.size);
+        // Bucket key b
+        const int bb = starBucketIndex(b.size);
+        // Compare buckets
+        if (ba != bb) {
+            // Bucket order
+            return ba < bb;
+        }
+        // Compare cells
+        return starGridCell(a) < starGridCell(b);
+    });
+
+    // Each bucket
+    for (int bkt = 0; bkt < starBucketCount; ++bkt) {
+        // Clear cells
+        gStarCells[bkt].clear();
+    }
+
+    // Star cursor
+    int cursor = 0;
+    // Group runs
+    while (cursor < (int)gStars.size()) {
+        // Run bucket
+        const int bkt = starBucketIndex(gStars[cursor].size);
+        // Run cell
+        const int cell = starGridCell(gStars[cursor]);
+        // New cell
+        StarCell sc;
+        // Run start
+        sc.start = cursor;
+        // Extend run
+        while (cursor < (int)gStars.size() &&
+               starBucketIndex(gStars[cursor].size) == bkt &&
+               starGridCell(gStars[cursor]) == cell) {
+            // Accumulate center
+            sc.cx += gStars[cursor].x;
+            // Accumulate y
+            sc.cy += gStars[cursor].y;
+            // Accumulate z
+            sc.cz += gStars[cursor].z;
+            // Next star
+            ++cursor;
+        }
+        // Run count
+        sc.count = cursor - sc.start;
+        // Average center
+        sc.cx /= sc.count;
+        // Average y
+        sc.cy /= sc.count;
+        // Average z
+        sc.cz /= sc.count;
+        // Member extent
+        for (int i = sc.start; i < cursor; ++i) {
+            // Center offset
+            const float dx = gStars[i].x - sc.cx;
+            // Offset y
+            const float dy = gStars[i].y - sc.cy;
+            // Offset z
+            const float dz = gStars[i].z - sc.cz;
+            // Grow radius
+            sc.radius = std::max(sc.radius, std::sqrt(dx*dx + dy*dy + dz*dz));
+        }
+        // Store cell
+        gStarCells[bkt].push_back(sc);
+    }
+
+    // Position data
+    std::vector<float> positions(gStars.size() * 3);
+    // Each star
+    for (size_t i = 0; i < gStars.size(); ++i) {
+        // Copy x
+        positions[i*3 + 0] = gStars[i].x;
+        // Copy y
+        positions[i*3 + 1] = gStars[i].y;
+        // Copy z
+        positions[i*3 + 2] = gStars[i].z;
+    }
+
+    // Create position buffer
+    if (gStarPosVbo == 0) {
+        // Generate buffer
+        glGenBuffers(1, &gStarPosVbo);
+    }
+    // Bind position buffer
+    glBindBuffer(GL_ARRAY_BUFFER, gStarPosVbo);
+    // Upload positions
+    glBufferData(GL_ARRAY_BUFFER, positions.size() * sizeof(float), positions.data(), GL_STATIC_DRAW);
+    // Unbind buffer
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // Size front colours
+    gStarColorBuf[0].assign(gStars.size() * 3, 0.f);
+    // Size back colours
+    gStarColorBuf[1].assign(gStars.size() * 3, 0.f);
+}
+
+// Star twinkle
+static inline void starTwinkleColour(const Star& s, float t, float* rgb) {
+    // Twinkle value
+    const float tw = s.base + s.amp * (0.5f * (std::sin(t * s.speed + s.phaseR) + 1.0f)) * 0.9f;
+    // Red
+    rgb[0] = std::min(1.f, std::max(0.f, tw * (0.6f + 0.4f * std::sin(t * s.speed * 1.1f + s.phaseR))));
+    // Green
+    rgb[1] = std::min(1.f, std::max(0.f, tw * (0.6f + 0.4f * std::sin(t * s.speed * 0.9f + s.phaseG))));
+    // Blue
+    rgb[2] = std::min(1.f, std::max(0.f, tw * (0.6f + 0.4f * std::sin(t * s.speed * 1.3f + s.phaseB))));
+}
+
+// Compute colours
+static void computeStarColours(int begin, int end, float t, float* dst) {
+    // Star slice
+    for (int i = begin; i < end; ++i) {
+        // Update colour
+        starTwinkleColour(gStars[i], t, &dst[i*3]);
+    }
+}
+
+// Kick frame task
+static void kickFrameTask() {
+    // Back buffer
+    const int back = 1 - gFrameFront;
+    // Capture time
+    const float t = float(gElapsedS);
+    // Sway yaw
+    gSwayYaw[back] = 10.f * std::sin(t * 0.4f);
+    // Sway pitch
+    gSwayPitch[back] = 5.f * std::sin(t * 0.7f);
+    // Shader twinkle
+    if (gStarShaderReady) {
+        // Sway only
+        gFrameTaskPending = true;
+        // GPU handles colours
+        return;
+    }
+    // Destination colours
+    float* dst = gStarColorBuf[back].data();
+
+    // Star total
+    const int n = (int)gStars.size();
+    // Slice count
+    const int slices = std::max(1, gTwinkleSlices);
+    // Slice length
+    const int sliceLen = (n + slices - 1) / slices;
+    // Current slice
+    const int cur = gTwinkleSlice;
+    // Previous slice
+    const int prev = (cur + slices - 1) % slices;
+    // Advance cursor
+    gTwinkleSlice = (cur + 1) % slices;
+
+    // Current begin
+    const int b1 = std::min(n, cur * sliceLen);
+    // Current end
+    const int e1 = std::min(n, b1 + sliceLen);
+    // Previous begin
+    const int b2 = std::min(n, prev * sliceLen);
+    // Previous end
+    const int e2 = std::min(n, b2 + sliceLen);
+    // Current length
+    const int len1 = e1 - b1;
+    // Combined length
+    const int total = len1 + (slices > 1 ? (e2 - b2) : 0);
+
+    // Dispatch twinkle
+    poolRunAsync(total, [t, dst, b1, len1, b2](int begin, int end) {
+        // Work slice
+        for (int i = begin; i < end; ++i) {
+            // Remap index
+            const int star = (i < len1) ? (b1 + i) : (b2 + (i - len1));
+            // Update colour
+            starTwinkleColour(gStars[star], t, &dst[star*3]);
+        }
+    });
+    // Mark pending
+    gFrameTaskPending = true;
+}
+
+// Finish frame task
+static void finishFrameTask() {
+    // Check pending
+    if (!gFrameTaskPending) {
+        // Nothing running
+        return;
+    }
+    // Wait workers
+    poolWait();
+    // Swap buffers
+    gFrameFront = 1 - gFrameFront;
+    // Clear pending
+    gFrameTaskPending = false;
+}
+
+// Draw stars
+static void drawStars() {
+    // Disable lighting
+    glDisable(GL_LIGHTING);
+
+    // Bind position buffer
+    glBindBuffer(GL_ARRAY_BUFFER, gStarPosVbo);
+    // Enable positions
+    glEnableClientState(GL_VERTEX_ARRAY);
+    // Position pointer
+    glVertexPointer(3, GL_FLOAT, 0, (const void*)0);
+    // Unbind buffer
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // Shader path
+    if (gStarShaderReady) {
+        // Use program
+        glUseProgram(gStarProgram);
+        // Set time
+        glUniform1f(gStarTimeLoc, float(gElapsedS));
+        // Bind attributes
+        glBindBuffer(GL_ARRAY_BUFFER, gStarAttrVbo);
+        // Enable phases
+        glEnableVertexAttribArray(1);
+        // Phase pointer
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (const void*)0);
+        // Enable params
+        glEnableVertexAttribArray(2);
+        // Params pointer
+        glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (const void*)(3 * sizeof(float)));
+        // Unbind buffer
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    } else {
+        // Enable colours
+        glEnableClientState(GL_COLOR_ARRAY);
+        // Colour pointer
+        glColorPointer(3, GL_FLOAT, 0, gStarColorBuf[gFrameFront].data());
+    }
+
+    // Each bucket
+    for (int bkt = 0; bkt < starBucketCount; ++bkt) {
+        // Check empty
+        if (gStarCells[bkt].empty()) {
+            // Skip bucket
+            continue;
+        }
+        // Set point size
+        glPointSize(starBucketSizes[bkt]);
+        // Each cell
+        for (const StarCell& sc : gStarCells[bkt]) {
+            // Cull cell
+            if (!sphereInFrustum(sc.cx, sc.cy, sc.cz, sc.radius)) {
+                // Skip cell
+                continue;
+            }
+            // Draw cell
+            glDrawArrays(GL_POINTS, sc.start, sc.count >> gQualityLevel);
+        }
+    }
+
+    // Shader cleanup
+    if (gStarShaderReady) {
+        // Disable params
+        glDisableVertexAttribArray(2);
+        // Disable phases
+        glDisableVertexAttribArray(1);
+        // Fixed function
+        glUseProgram(0);
+    } else {
+        // Disable colours
+        glDisableClientState(GL_COLOR_ARRAY);
+    }
+    // Disable positions
+    glDisableClientState(GL_VERTEX_ARRAY);
+    // Enable lighting
+    glEnable(GL_LIGHTING);
+}
+
+// Cache magic
+constexpr std::uint32_t entCacheMagic = 0x4D544E45u;
+// Cache version
+constexpr std::uint32_t entCacheVersion = 2;
+
+// Cache header
+struct MeshCacheHeader {
+    // Magic word
+    std::uint32_t magic;
+    // Format version
+    std::uint32_t version;
+    // Vertex count
+    std::uint32_t vertexCount;
+    // Triangle count
+    std::uint32_t triCount;
+    // Mesh scale
+    float scale;
+};
+
+// Load binary
+static bool loadEnterpriseBinary(const char* path, std::vector<Vector>& verts,
+                                 std::vector<Vector>& normals, std::vector<Tri>& tris, float& scale) {
+    // Open file
+    const int fd = open(path, O_RDONLY);
+    // Check open
+    if (fd < 0) {
+        // No file
+        return false;
+    }
+
+    // File info
+    struct stat info{};
+    // Stat file
+    if (fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(MeshCacheHeader)) {
+        // Close file
+        close(fd);
+        // Bad file
+        return false;
+    }
+
+    // Map file
+    void* base = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // Check mapping
+    if (base == MAP_FAILED) {
+        // Close file
+        close(fd);
+        // No mapping
+        return false;
+    }
+
+    // Read header
+    MeshCacheHeader header{};
+    // Copy header
+    std::memcpy(&header, base, sizeof(header));
+
+    // Expected size
+    const size_t expected = sizeof(header)
+                          + header.vertexCount * sizeof(Vector) * 2
+                          + header.triCount * sizeof(Tri);
+    // Validate header
+    if (header.magic != entCacheMagic || header.version != entCacheVersion ||
+        (size_t)info.st_size < expected) {
+        // Unmap file
+        munmap(base, (size_t)info.st_size);
+        // Close file
+        close(fd);
+        // Stale cache
+        return false;
+    }
+
+    // Vertex source
+    const char* src = (const char*)base + sizeof(header);
+    // Size vertices
+    verts.resize(header.vertexCount);
+    // Copy vertices
+    std::memcpy(verts.data(), src, header.vertexCount * sizeof(Vector));
+    // Advance source
+    src += header.vertexCount * sizeof(Vector);
+    // Size normals
+    normals.resize(header.vertexCount);
+    // Copy normals
+    std::memcpy(normals.data(), src, header.vertexCount * sizeof(Vector));
+    // Advance source
+    src += header.vertexCount * sizeof(Vector);
+    // Size triangles
+    tris.resize(header.triCount);
+    // Copy triangles
+    std::memcpy(tris.data(), src, header.triCount * sizeof(Tri));
+    // Restore scale
+    scale = header.scale;
+
+    // Unmap file
+    munmap(base, (size_t)info.st_size);
+    // Close file
+    close(fd);
+    // Success
+    return true;
+}
+
+// Save binary
+static void saveEnterpriseBinary(const char* path, const std::vector<Vector>& verts,
+                                 const std::vector<Vector>& normals,
+                                 const std::vector<Tri>& tris, float scale) {
+    // Open file
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    // Check open
+    if (!out) {
+        // Skip cache
+        return;
+    }
+
+    // Build header
+    MeshCacheHeader header{};
+    // Set magic
+    header.magic = entCacheMagic;
+    // Set version
+    header.version = entCacheVersion;
+    // Set vertices
+    header.vertexCount = (std::uint32_t)verts.size();
+    // Set triangles
+    header.triCount = (std::uint32_t)tris.size();
+    // Set scale
+    header.scale = scale;
+
+    // Write header
+    out.write((const char*)&header, sizeof(header));
+    // Write vertices
+    out.write((const char*)verts.data(), verts.size() * sizeof(Vector));
+    // Write normals
+    out.write((const char*)normals.data(), normals.size() * sizeof(Vector));
+    // Write triangles
+    out.write((const char*)tris.data(), tris.size() * sizeof(Tri));
+}
+
+// Vertex normals
+static void computeVertexNormals(const std::vector<Vector>& verts, const std::vector<Tri>& tris,
+                                 std::vector<Vector>& normals) {
+    // Vertex count
+    const int nVerts = (int)verts.size();
+    // Zero normals
+    normals.assign(nVerts, Vector{0, 0, 0});
+
+    // Each triangle
+    for (const auto& t : tris) {
+        // Index A
+        const int ia = std::max(0, t.a - 1);
+        // Index B
+        const int ib = std::max(0, t.b - 1);
+        // Index C
+        const int ic = std::max(0, t.c - 1);
+        // Bounds check
+        if (ia >= nVerts || ib >= nVerts || ic >= nVerts)
+            // Skip triangle
+            continue;
+        // Area-weighted normal
+        const Vector N = cross(sub(verts[ib], verts[ia]), sub(verts[ic], verts[ia]));
+        // Accumulate A
+        normals[ia] = add(normals[ia], N);
+        // Accumulate B
+        normals[ib] = add(normals[ib], N);
+        // Accumulate C
+        normals[ic] = add(normals[ic], N);
+    }
+
+    // Each normal
+    for (auto& n : normals) {
+        // Normalize accumulated
+        normalize(n);
+    }
+}
+
+// Load Enterprise
+static bool loadEnterpriseData(std::vector<Vector>& verts, std::vector<Vector>& normals,
+                               std::vector<Tri>& tris, float& scale) {
+    // Text path
+    const char* textPath = "enterprise.txt";
+    // Cache path
+    const char* binPath = "enterprise.bin";
+
+    // Clear vertices
+    verts.clear();
+    // Clear normals
+    normals.clear();
+    // Clear triangles
+    tris.clear();
+
+    // Try cache
+    if (binaryCacheFresh(textPath, binPath) && loadEnterpriseBinary(binPath, verts, normals, tris, scale)) {
+        // Cache hit
+        return true;
+    }
+
+    // Open file
+    std::ifstream in(textPath);
+    // Line buffer
+    std::string line;
+
+    // Read lines
+    while (std::getline(in, line)) {
+        // Check empty
+        if (line.empty()) {
+            // Skip line
+            continue;
+        }
+
+        // Parse line
+        std::istringstream ss(line);
+        // Line type
+        char type;
+        // Read type
+        ss >> type;
+
+        // Vertex line
+        if (type == 'v') {
+            // Create vertex
+            Vector v{};
+            // Read coordinates
+            ss >> v.x >> v.y >> v.z;
+            // Add vertex
+            verts.push_back(v);
+        }
+        // Face line
+        else if (type == 'f') {
+            // Create triangle
+            Tri t{};
+            // Read indices
+            ss >> t.a >> t.b >> t.c;
+            // Add triangle
+            tris.push_back(t);
+        }
+    }
+
+    // Minimum bounds
     Vector mn{std::numeric_limits<float>::max(),
           std::numeric_limits<float>::max(),
           std::numeric_limits<float>::max()};
@@ -554,7 +3050,7 @@ static bool loadEnterprise() {
     Vector mx{-mn.x, -mn.y, -mn.z};
 
     // Each vertex
-    for (auto& v : gEntVerts) {
+    for (auto& v : verts) {
         // Min x
         mn.x = std::min(mn.x, v.x);
         // Min y
@@ -580,10 +3076,10 @@ static bool loadEnterprise() {
     // Longest axis
     const float longest = std::max(sx, std::max(sy, sz));
     // Calculate scale
-    gEntScale = (longest > 1e-4f) ? (6.0f / longest) : 1.0f;
+    scale = (longest > 1e-4f) ? (6.0f / longest) : 1.0f;
 
     // Each vertex
-    for (auto& v : gEntVerts) {
+    for (auto& v : verts) {
         // Center x
         v.x -= center.x;
         // Center y
@@ -592,12 +3088,208 @@ static bool loadEnterprise() {
         v.z -= center.z;
     }
 
+    // Smooth normals
+    computeVertexNormals(verts, tris, normals);
+
+    // Write cache
+    saveEnterpriseBinary(binPath, verts, normals, tris, scale);
+
     // Success
     return true;
 }
 
+// Upload Enterprise
+static void uploadEnterpriseMesh() {
+    // Vertex count
+    const int nVerts = (int)gEntVerts.size();
+    // Interleaved data
+    float* data = arenaAllocT<float>(gLoadArena, (size_t)nVerts * 6);
+    // Mesh indices
+    GLuint* indices = arenaAllocT<GLuint>(gLoadArena, gEntTris.size() * 3);
+    // Index cursor
+    size_t indexCount = 0;
+
+    // Missing normals
+    if ((int)gEntNormals.size() != nVerts) {
+        // Recompute normals
+        computeVertexNormals(gEntVerts, gEntTris, gEntNormals);
+    }
+
+    // Each triangle
+    for (const auto& t : gEntTris) {
+        // Index A
+        const int ia = std::max(0, t.a - 1);
+        // Index B
+        const int ib = std::max(0, t.b - 1);
+        // Index C
+        const int ic = std::max(0, t.c - 1);
+        // Bounds check
+        if (ia >= nVerts || ib >= nVerts || ic >= nVerts)
+            // Skip triangle
+            continue;
+        // Store A
+        indices[indexCount++] = GLuint(ia);
+        // Store B
+        indices[indexCount++] = GLuint(ib);
+        // Store C
+        indices[indexCount++] = GLuint(ic);
+    }
+
+    // Each vertex
+    for (int i = 0; i < nVerts; ++i) {
+        // Position x
+        data[i*6 + 0] = gEntVerts[i].x;
+        // Position y
+        data[i*6 + 1] = gEntVerts[i].y;
+        // Position z
+        data[i*6 + 2] = gEntVerts[i].z;
+        // Normal x
+        data[i*6 + 3] = gEntNormals[i].x;
+        // Normal y
+        data[i*6 + 4] = gEntNormals[i].y;
+        // Normal z
+        data[i*6 + 5] = gEntNormals[i].z;
+    }
+
+    // Save count
+    gEntIndexCount = (GLsizei)indexCount;
+
+    // Create vertex buffer
+    if (gEntVbo == 0) {
+        // Generate buffer
+        glGenBuffers(1, &gEntVbo);
+    }
+    // Create index buffer
+    if (gEntIbo == 0) {
+        // Generate buffer
+        glGenBuffers(1, &gEntIbo);
+    }
+
+    // Bind vertex buffer
+    glBindBuffer(GL_ARRAY_BUFFER, gEntVbo);
+    // Upload vertices
+    glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)(nVerts * 6 * sizeof(float)), data, GL_STATIC_DRAW);
+    // Bind index buffer
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, gEntIbo);
+    // Upload indices
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)(indexCount * sizeof(GLuint)), indices, GL_STATIC_DRAW);
+    // Unbind vertex buffer
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    // Unbind index buffer
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    // Recycle scratch
+    arenaReset(gLoadArena);
+}
+
+// Loader thread
+std::thread gEntLoader;
+// Loader mutex
+std::mutex gEntLoadMutex;
+// Pending vertices
+std::vector<Vector> gEntPendingVerts;
+// Pending normals
+std::vector<Vector> gEntPendingNormals;
+// Pending triangles
+std::vector<Tri> gEntPendingTris;
+// Pending scale
+float gEntPendingScale = 1.0f;
+// Load ready
+bool gEntLoadReady = false;
+// Load running
+bool gEntLoadRunning = false;
+
+// Reap loader
+static void joinEnterpriseLoader() {
+    // Check joinable
+    if (gEntLoader.joinable()) {
+        // Join thread
+        gEntLoader.join();
+    }
+}
+
+// Start load
+static void startEnterpriseLoad() {
+    // Check running
+    {
+        // Hold lock
+        std::lock_guard<std::mutex> lock(gEntLoadMutex);
+        // Already loading
+        if (gEntLoadRunning) {
+            // Ignore request
+            return;
+        }
+        // Mark running
+        gEntLoadRunning = true;
+    }
+    // Reap previous
+    joinEnterpriseLoader();
+    // Spawn loader
+    gEntLoader = std::thread([] {
+        // Local vertices
+        std::vector<Vector> verts;
+        // Local normals
+        std::vector<Vector> normals;
+        // Local triangles
+        std::vector<Tri> tris;
+        // Local scale
+        float scale = 1.0f;
+        // Parse mesh
+        loadEnterpriseData(verts, normals, tris, scale);
+        // Hold lock
+        std::lock_guard<std::mutex> lock(gEntLoadMutex);
+        // Publish vertices
+        gEntPendingVerts = std::move(verts);
+        // Publish normals
+        gEntPendingNormals = std::move(normals);
+        // Publish triangles
+        gEntPendingTris = std::move(tris);
+        // Publish scale
+        gEntPendingScale = scale;
+        // Mark ready
+        gEntLoadReady = true;
+        // Mark idle
+        gEntLoadRunning = false;
+    });
+}
+
+// Poll load
+static void pollEnterpriseLoad() {
+    // Adopt scope
+    {
+        // Hold lock
+        std::lock_guard<std::mutex> lock(gEntLoadMutex);
+        // Check ready
+        if (!gEntLoadReady) {
+            // Still loading
+            return;
+        }
+        // Adopt vertices
+        gEntVerts = std::move(gEntPendingVerts);
+        // Adopt normals
+        gEntNormals = std::move(gEntPendingNormals);
+        // Adopt triangles
+        gEntTris = std::move(gEntPendingTris);
+        // Adopt scale
+        gEntScale = gEntPendingScale;
+        // Clear ready
+        gEntLoadReady = false;
+    }
+    // Upload buffers
+    uploadEnterpriseMesh();
+    // Reap loader
+    if (gEntLoader.joinable()) {
+        // Join thread
+        gEntLoader.join();
+    }
+}
+
 // Draw Enterprise
 static void drawEnterpriseMesh() {
+    // Check mesh
+    if (gEntIndexCount == 0) {
+        // Nothing uploaded
+        return;
+    }
 
     // Save matrix
     glPushMatrix();
@@ -606,55 +3298,213 @@ static void drawEnterpriseMesh() {
     // Scale mesh
     glScalef(gEntScale, gEntScale, gEntScale);
     // Rotate Y
-    glRotatef(10.f * std::sin(gElapsedS*0.4), 0,1,0);
+    glRotatef(gSwayYaw[gFrameFront], 0,1,0);
     // Rotate X
-    glRotatef(5.f  * std::sin(gElapsedS*0.7), 1,0,0);
+    glRotatef(gSwayPitch[gFrameFront], 1,0,0);
 
     // Hull colour
     const float hull[3] = {0.75f, 0.80f, 0.95f};
     // Apply material
     setMaterial(hull);
 
-    // Begin triangles
-    glBegin(GL_TRIANGLES);
-    // Each triangle
-    for (const auto& t : gEntTris) {
-
-        // Index A
-        const int ia = std::max(0, t.a - 1);
-        // Index B
-        const int ib = std::max(0, t.b - 1);
-        // Index C
-        const int ic = std::max(0, t.c - 1);
-        // Bounds check
-        if (ia >= (int)gEntVerts.size() || ib >= (int)gEntVerts.size() || ic >= (int)gEntVerts.size())
-            // Skip triangle
-            continue;
-        // Vertex A
-        const Vector& A = gEntVerts[ia];
-        // Vertex B
-        const Vector& B = gEntVerts[ib];
-        // Vertex C
-        const Vector& C = gEntVerts[ic];
-        // Calculate normal
-        Vector N = cross(sub(B,A), sub(C,A));
-        // Normalize normal
-        normalize(N);
-        // Set normal
-        glNormal3f(N.x, N.y, N.z);
-        // Vertex A
-        glVertex3f(A.x, A.y, A.z);
-        // Vertex B
-        glVertex3f(B.x, B.y, B.z);
-        // Vertex C
-        glVertex3f(C.x, C.y, C.z);
-    }
-    // End triangles
-    glEnd();
+    // Bind vertex buffer
+    glBindBuffer(GL_ARRAY_BUFFER, gEntVbo);
+    // Bind index buffer
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, gEntIbo);
+    // Enable positions
+    glEnableClientState(GL_VERTEX_ARRAY);
+    // Enable normals
+    glEnableClientState(GL_NORMAL_ARRAY);
+    // Position pointer
+    glVertexPointer(3, GL_FLOAT, 6 * sizeof(float), (const void*)0);
+    // Normal pointer
+    glNormalPointer(GL_FLOAT, 6 * sizeof(float), (const void*)(3 * sizeof(float)));
+    // Draw indexed
+    glDrawElements(GL_TRIANGLES, gEntIndexCount, GL_UNSIGNED_INT, (const void*)0);
+    // Disable normals
+    glDisableClientState(GL_NORMAL_ARRAY);
+    // Disable positions
+    glDisableClientState(GL_VERTEX_ARRAY);
+    // Unbind index buffer
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    // Unbind vertex buffer
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
     // Restore matrix
     glPopMatrix();
 }
 
+// Belt rocks
+int gBeltCount = 0;
+// Belt bands
+constexpr int beltBandCount = 16;
+// Belt inner radius
+constexpr float beltInnerR = 44.f;
+// Belt outer radius
+constexpr float beltOuterR = 52.f;
+// Band angles
+float gBeltAngle[beltBandCount] = {};
+// Previous angles
+float gBeltPrevAngle[beltBandCount] = {};
+// Band speeds
+float gBeltSpeed[beltBandCount] = {};
+// Belt vertex buffer
+GLuint gBeltVbo = 0;
+// Belt index buffer
+GLuint gBeltIbo = 0;
+// Band index offsets
+GLsizei gBeltBandStart[beltBandCount] = {};
+// Band index counts
+GLsizei gBeltBandIndices[beltBandCount] = {};
+
+// Rock vertices
+constexpr int rockVertCount = 6;
+// Rock triangles
+constexpr int rockTriCount = 8;
+// Octahedron corners
+constexpr float rockCorner[rockVertCount][3] = {
+    {1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}
+};
+// Octahedron faces
+constexpr int rockFace[rockTriCount][3] = {
+    {0, 2, 4}, {2, 1, 4}, {1, 3, 4}, {3, 0, 4},
+    {2, 0, 5}, {1, 2, 5}, {3, 1, 5}, {0, 3, 5}
+};
+
+// Build belt
+static void initBelt() {
+    // Check enabled
+    if (gBeltCount <= 0) {
+        // No belt
+        return;
+    }
+
+    // Band rocks
+    const int perBand = (gBeltCount + beltBandCount - 1) / beltBandCount;
+    // Interleaved data
+    std::vector<float> data;
+    // Belt indices
+    std::vector<GLuint> indices;
+    // Reserve vertices
+    data.reserve((size_t)perBand * beltBandCount * rockVertCount * 6);
+    // Reserve indices
+    indices.reserve((size_t)perBand * beltBandCount * rockTriCount * 3);
+
+    // Band width
+    const float bandW = (beltOuterR - beltInnerR) / beltBandCount;
+    // Each band
+    for (int band = 0; band < beltBandCount; ++band) {
+        // Band radius
+        const float bandR = beltInnerR + (band + 0.5f) * bandW;
+        // Kepler-ish speed
+        gBeltSpeed[band] = 120.f / std::sqrt(bandR);
+        // Random phase
+        gBeltAngle[band] = frandRange(0.f, 360.f);
+        // Seed previous
+        gBeltPrevAngle[band] = gBeltAngle[band];
+        // Index offset
+        gBeltBandStart[band] = (GLsizei)indices.size();
+
+        // Each rock
+        for (int rock = 0; rock < perBand; ++rock) {
+            // Orbit angle
+            const float a = frandRange(0.f, 2.f * PI);
+            // Orbit radius
+            const float r = bandR + frandRange(-0.5f, 0.5f) * bandW;
+            // Rock centre
+            const float cx = r * std::cos(a);
+            // Height jitter
+            const float cy = frandRange(-0.8f, 0.8f);
+            // Rock centre
+            const float cz = r * std::sin(a);
+            // Rock scale
+            const float s = frandRange(0.04f, 0.18f);
+            // Spin angle
+            const float spin = frandRange(0.f, 2.f * PI);
+            // Spin rotation
+            const float cs = std::cos(spin);
+            // Spin rotation
+            const float sn = std::sin(spin);
+            // Base vertex
+            const GLuint base = (GLuint)(data.size() / 6);
+
+            // Each corner
+            for (int v = 0; v < rockVertCount; ++v) {
+                // Radial jitter
+                const float jitter = frandRange(0.7f, 1.3f);
+                // Jittered x
+                const float jx = rockCorner[v][0] * jitter;
+                // Jittered y
+                const float jy = rockCorner[v][1] * jitter;
+                // Jittered z
+                const float jz = rockCorner[v][2] * jitter;
+                // Spun x
+                const float rx = jx * cs - jz * sn;
+                // Spun z
+                const float rz = jx * sn + jz * cs;
+                // Normal vector
+                Vector n{rx, jy, rz};
+                // Unit normal
+                normalize(n);
+                // Position x
+                data.push_back(cx + rx * s);
+                // Position y
+                data.push_back(cy + jy * s);
+                // Position z
+                data.push_back(cz + rz * s);
+                // Normal x
+                data.push_back(n.x);
+                // Normal y
+                data.push_back(n.y);
+                // Normal z
+                data.push_back(n.z);
+            }
+            // Each face
+            for (int f = 0; f < rockTriCount; ++f) {
+                // Corner A
+                indices.push_back(base + rockFace[f][0]);
+                // Corner B
+                indices.push_back(base + rockFace[f][1]);
+                // Corner C
+                indices.push_back(base + rockFace[f][2]);
+            }
+        }
+        // Index count
+        gBeltBandIndices[band] = (GLsizei)indices.size() - gBeltBandStart[band];
+    }
+
+    // Create vertex buffer
+    glGenBuffers(1, &gBeltVbo);
+    // Create index buffer
+    glGenBuffers(1, &gBeltIbo);
+    // Bind vertex buffer
+    glBindBuffer(GL_ARRAY_BUFFER, gBeltVbo);
+    // Upload vertices
+    glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(float), data.data(), GL_STATIC_DRAW);
+    // Bind index buffer
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, gBeltIbo);
+    // Upload indices
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), indices.data(), GL_STATIC_DRAW);
+    // Unbind index buffer
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    // Unbind vertex buffer
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+// Advance belt
+static void advanceBelt(float dt) {
+    // Bulk advance
+    for (int band = 0; band < beltBandCount; ++band) {
+        // Save angle
+        gBeltPrevAngle[band] = gBeltAngle[band];
+        // Step angle
+        float a = gBeltAngle[band] + gBeltSpeed[band] * dt;
+        // Branchless wrap
+        a -= 360.f * float(a >= 360.f);
+        // Store angle
+        gBeltAngle[band] = a;
+    }
+}
+
 // Print controls
 static void printControls() {
 
@@ -664,6 +3514,20 @@ static void printControls() {
     std::printf("-------------------------------\n");
     // R key
     std::printf("R           : toggle rings\n");
+    // P key
+    std::printf("P           : toggle profiler HUD\n");
+    // C key
+    std::printf("C           : toggle CSV capture\n");
+    // L key
+    std::printf("L           : reload ship model\n");
+    // G key
+    std::printf("G           : toggle sun glow\n");
+    // N key
+    std::printf("N           : toggle N-body gravity\n");
+    // T key
+    std::printf("T           : toggle orbit trails\n");
+    // V key
+    std::printf("V           : cycle view count\n");
     // Up arrow
     std::printf("Up Arrow    : move up\n");
     // Down arrow
@@ -682,8 +3546,16 @@ static void printControls() {
 
 // Initialize OpenGL
 static void initGL() {
+    // Build trig tables
+    initTrigTables();
+    // Frame arena
+    arenaInit(gFrameArena, 256 * 1024);
+    // Load arena
+    arenaInit(gLoadArena, 4 * 1024 * 1024);
     // Enable depth
     glEnable(GL_DEPTH_TEST);
+    // Pre-pass equality
+    glDepthFunc(GL_LEQUAL);
     // Enable culling
     glEnable(GL_CULL_FACE);
     // Cull back
@@ -714,59 +3586,407 @@ static void initGL() {
     gluQuadricNormals(gQuad, GLU_SMOOTH);
     // Fill style
     gluQuadricDrawStyle(gQuad, GLU_FILL);
+    // Cache sphere geometry
+    initSphereCache();
+    // Rescale normals
+    glEnable(GL_NORMALIZE);
 
     // Seed random
-    std::srand(unsigned(std::time(nullptr)));
+    seedRng(gUseGenerator ? gGenSeed
+                          : (gBenchMode ? 12345ull : (std::uint64_t)std::time(nullptr)));
 
-    // Initialize planets
-    initSystem();
+    // Check scene
+    if (gUseSceneFile && loadScene(gScenePath)) {
+        // Scene loaded
+        std::printf("scene: loaded %s\n", gScenePath.c_str());
+    }
+    // Check generator
+    else if (gUseGenerator) {
+        // Generate planets
+        generateSystem(gGenSeed, gGenPlanetCount);
+    } else {
+        // Scene failed
+        if (gUseSceneFile) {
+            // Report fallback
+            std::printf("scene: failed to load %s, using defaults\n", gScenePath.c_str());
+        }
+        // Initialize planets
+        initSystem();
+    }
+    // Build body state
+    initBodyState();
+    // Allocate trails
+    initTrails();
+    // Build draw order
+    initDrawOrder();
+    // Build orbit rings
+    initOrbitRings();
+    // Build belt
+    initBelt();
     // Initialize stars
     initStars();
+    // Build shader
+    initStarShader();
+    // Upload attributes
+    uploadStarAttributes();
+    // Start workers
+    initWorkerPool();
+    // Prime front colours
+    computeStarColours(0, (int)gStars.size(), 0.f, gStarColorBuf[0].data());
+    // Prime back colours
+    gStarColorBuf[1] = gStarColorBuf[0];
     // Load model
-    loadEnterprise();
+    startEnterpriseLoad();
+    // Join at exit
+    std::atexit(joinEnterpriseLoader);
     // Print controls
     printControls();
     // Initialize time
     gPrevMillis = glutGet(GLUT_ELAPSED_TIME);
 }
 
-// Update angles
-static void updateAngles(float dt) {
-    // Each planet
-    for (auto& p : gPlanets) {
-        // Update angle
-        p.angle += p.speed * dt;
-        // Wrap angle
-        if (p.angle >= 360.f) {
-            // Subtract 360
-            p.angle -= 360.f;
+// Interpolate angle
+static inline float lerpAngle(float a, float b, float t) {
+    // Unwrap wraparound
+    if (b < a) {
+        // Restore continuity
+        b += 360.f;
+    }
+    // Blend angles
+    return a + (b - a) * t;
+}
+
+// Evaluate positions
+static void evaluateBodyPositions(float alpha) {
+    // Physics mode
+    if (gNBodyMode) {
+        // Body count
+        const int n = (int)gBodyNX.size();
+        // Interpolate positions
+        for (int i = 0; i < n; ++i) {
+            // Blend x
+            gBodyPosX[i] = gBodyPrevNX[i] + (gBodyNX[i] - gBodyPrevNX[i]) * alpha;
+            // Blend z
+            gBodyPosZ[i] = gBodyPrevNZ[i] + (gBodyNZ[i] - gBodyPrevNZ[i]) * alpha;
+        }
+        // Resolve locals
+        for (int i = 0; i < n; ++i) {
+            // Parent slot
+            const int par = gBodyParent[i];
+            // Local x
+            gBodyLocalX[i] = (par >= 0) ? gBodyPosX[i] - gBodyPosX[par] : gBodyPosX[i];
+            // Local z
+            gBodyLocalZ[i] = (par >= 0) ? gBodyPosZ[i] - gBodyPosZ[par] : gBodyPosZ[i];
         }
+        // Done
+        return;
+    }
 
-        // Each moon
-        for (auto& m : p.moons) {
-            // Update angle
-            m.angle += m.speed * dt;
-            // Wrap angle
-            if (m.angle >= 360.f) {
-                // Subtract 360
-                m.angle -= 360.f;
-            }
+    // Body count
+    const int n = (int)gBodyAngle.size();
+    // Angle array
+    const float* angle = gBodyAngle.data();
+    // Previous array
+    const float* prev = gBodyPrevAngle.data();
+    // X radius array
+    const float* rx = gBodyOrbitRX.data();
+    // Z radius array
+    const float* rz = gBodyOrbitRZ.data();
+    // Parent array
+    const int* parent = gBodyParent.data();
+    // Local X array
+    float* lx = gBodyLocalX.data();
+    // Local Z array
+    float* lz = gBodyLocalZ.data();
+    // World X array
+    float* px = gBodyPosX.data();
+    // World Z array
+    float* pz = gBodyPosZ.data();
+
+    // Bulk evaluate
+    for (int i = 0; i < n; ++i) {
+        // Render angle
+        const float a = lerpAngle(prev[i], angle[i], alpha);
+        // Local x
+        lx[i] = rx[i] * cosDeg(a);
+        // Local z
+        lz[i] = rz[i] * sinDeg(a);
+        // World x
+        px[i] = lx[i];
+        // World z
+        pz[i] = lz[i];
+    }
+
+    // Resolve parents
+    for (int i = 0; i < n; ++i) {
+        // Check parent
+        if (parent[i] >= 0) {
+            // Offset x
+            px[i] += px[parent[i]];
+            // Offset z
+            pz[i] += pz[parent[i]];
+        }
+    }
+}
+
+// Record trail
+static void appendTrailSample() {
+    // Body count
+    const int n = (int)gBodyAngle.size();
+    // Current positions
+    evaluateBodyPositions(1.f);
+    // Write slot
+    const int slot = gTrailHead;
+    // Each body
+    for (int i = 0; i < n; ++i) {
+        // Record x
+        gTrailX[(size_t)i * trailCapacity + slot] = gBodyPosX[i];
+        // Record z
+        gTrailZ[(size_t)i * trailCapacity + slot] = gBodyPosZ[i];
+    }
+    // Advance head
+    gTrailHead = (slot + 1) % trailCapacity;
+    // Grow fill
+    gTrailCount = std::min(trailCapacity, gTrailCount + 1);
+}
+
+// Draw trails
+static void drawTrails() {
+    // Check fill
+    if (gTrailCount < 2) {
+        // Nothing recorded
+        return;
+    }
+
+    // Strip scratch
+    float* strip = arenaAllocT<float>(gFrameArena, (size_t)gTrailCount * 3);
+    // Colour scratch
+    float* colour = arenaAllocT<float>(gFrameArena, (size_t)gTrailCount * 4);
+
+    // Disable lighting
+    glDisable(GL_LIGHTING);
+    // Enable blending
+    glEnable(GL_BLEND);
+    // Alpha blend
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    // Enable positions
+    glEnableClientState(GL_VERTEX_ARRAY);
+    // Enable colours
+    glEnableClientState(GL_COLOR_ARRAY);
+    // Position pointer
+    glVertexPointer(3, GL_FLOAT, 0, strip);
+    // Colour pointer
+    glColorPointer(4, GL_FLOAT, 0, colour);
+
+    // Oldest slot
+    const int tail = (gTrailHead - gTrailCount + trailCapacity) % trailCapacity;
+    // Body count
+    const int n = (int)gBodyAngle.size();
+    // Each body
+    for (int i = 0; i < n; ++i) {
+        // Body history x
+        const float* hx = &gTrailX[(size_t)i * trailCapacity];
+        // Body history z
+        const float* hz = &gTrailZ[(size_t)i * trailCapacity];
+        // Unroll ring
+        for (int s = 0; s < gTrailCount; ++s) {
+            // Ring slot
+            const int slot = (tail + s) % trailCapacity;
+            // Strip x
+            strip[s*3 + 0] = hx[slot];
+            // Strip y
+            strip[s*3 + 1] = 0.f;
+            // Strip z
+            strip[s*3 + 2] = hz[slot];
+            // Fade factor
+            const float fade = float(s + 1) / float(gTrailCount);
+            // Trail red
+            colour[s*4 + 0] = 0.7f;
+            // Trail green
+            colour[s*4 + 1] = 0.8f;
+            // Trail blue
+            colour[s*4 + 2] = 1.0f;
+            // Trail alpha
+            colour[s*4 + 3] = 0.45f * fade;
         }
+        // Draw strip
+        glDrawArrays(GL_LINE_STRIP, 0, gTrailCount);
+    }
+
+    // Disable colours
+    glDisableClientState(GL_COLOR_ARRAY);
+    // Disable positions
+    glDisableClientState(GL_VERTEX_ARRAY);
+    // Disable blending
+    glDisable(GL_BLEND);
+    // Enable lighting
+    glEnable(GL_LIGHTING);
+}
+
+// Update angles
+static void updateAngles(float dt) {
+    // Save camera
+    gCamPrevPos = gCamPos;
+    // Advance bodies
+    if (gNBodyMode) {
+        // Gravity step
+        nbodyStep(dt);
+    } else {
+        // Kinematic step
+        advanceBodies(dt);
     }
     // Update elapsed
     gElapsedS += dt;
+    // Advance belt
+    advanceBelt(dt);
+    // Accumulate trail
+    gTrailAccum += dt;
+    // Sample due
+    while (gTrailAccum >= trailSampleDt) {
+        // Record positions
+        appendTrailSample();
+        // Consume period
+        gTrailAccum -= trailSampleDt;
+    }
     // Update camera
     integrateCamera(dt);
 }
 
+// Planet bound
+static inline float planetBoundRadius(const Planet& p) {
+    // Body radius
+    float bound = p.radius;
+    // Each moon
+    for (const auto& m : p.moons) {
+        // Moon extent
+        bound = std::max(bound, m.orbitR + m.radius);
+    }
+    // Combined radius
+    return bound;
+}
+
+// Draw belt
+static void drawBelt() {
+    // Check enabled
+    if (gBeltCount <= 0) {
+        // No belt
+        return;
+    }
+    // Cull belt
+    if (!sphereInFrustum(0.f, 0.f, 0.f, beltOuterR + 1.f)) {
+        // Off screen
+        return;
+    }
+
+    // Rock colour
+    const float rock[3] = {0.45f, 0.40f, 0.35f};
+    // Apply material
+    setMaterial(rock);
+
+    // Bind vertex buffer
+    glBindBuffer(GL_ARRAY_BUFFER, gBeltVbo);
+    // Bind index buffer
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, gBeltIbo);
+    // Enable positions
+    glEnableClientState(GL_VERTEX_ARRAY);
+    // Enable normals
+    glEnableClientState(GL_NORMAL_ARRAY);
+    // Position pointer
+    glVertexPointer(3, GL_FLOAT, 6 * sizeof(float), (const void*)0);
+    // Normal pointer
+    glNormalPointer(GL_FLOAT, 6 * sizeof(float), (const void*)(3 * sizeof(float)));
+
+    // Each band
+    for (int band = 0; band < beltBandCount; ++band) {
+        // Save matrix
+        glPushMatrix();
+        // Band rotation
+        glRotatef(lerpAngle(gBeltPrevAngle[band], gBeltAngle[band], gSimAlpha), 0, 1, 0);
+        // Draw band
+        glDrawElements(GL_TRIANGLES, gBeltBandIndices[band], GL_UNSIGNED_INT,
+                       (const void*)(size_t)(gBeltBandStart[band] * sizeof(GLuint)));
+        // Restore matrix
+        glPopMatrix();
+    }
+
+    // Disable normals
+    glDisableClientState(GL_NORMAL_ARRAY);
+    // Disable positions
+    glDisableClientState(GL_VERTEX_ARRAY);
+    // Unbind index buffer
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    // Unbind vertex buffer
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+// View descriptor
+struct ViewDesc {
+    // Viewport rect
+    int x, y, w, h;
+    // Yaw offset
+    float yawOffset;
+    // Pitch offset
+    float pitchOffset;
+};
+
+// View count
+int gViewCount = 1;
+
+// Build view
+static ViewDesc viewDescFor(int index) {
+    // Window width
+    const int winW = glutGet(GLUT_WINDOW_WIDTH);
+    // Window height
+    const int winH = glutGet(GLUT_WINDOW_HEIGHT);
+    // Full window
+    ViewDesc view{0, 0, winW, winH, 0.f, 0.f};
+
+    // Side-by-side
+    if (gViewCount == 2) {
+        // Half width
+        const int half = winW / 2;
+        // Tile x
+        view.x = index * half;
+        // Tile width
+        view.w = half;
+        // Spread yaw
+        view.yawOffset = (index == 0) ? -32.5f : 32.5f;
+    }
+    // Quad grid
+    else if (gViewCount == 4) {
+        // Half width
+        const int halfW = winW / 2;
+        // Half height
+        const int halfH = winH / 2;
+        // Tile x
+        view.x = (index & 1) * halfW;
+        // Tile y
+        view.y = (index >> 1) * halfH;
+        // Tile width
+        view.w = halfW;
+        // Tile height
+        view.h = halfH;
+        // Spread yaw
+        view.yawOffset = (index & 1) ? 32.5f : -32.5f;
+        // Spread pitch
+        view.pitchOffset = (index >> 1) ? 25.f : -25.f;
+    }
+    // Tile descriptor
+    return view;
+}
+
 // Setup camera
-static void setupCamera() {
+static void setupCamera(const ViewDesc& view) {
+    // Set viewport
+    glViewport(view.x, view.y, view.w, view.h);
     // Projection mode
     glMatrixMode(GL_PROJECTION);
     // Reset matrix
     glLoadIdentity();
     // Set perspective
-    gluPerspective(65, (double)glutGet(GLUT_WINDOW_WIDTH)/(double)glutGet(GLUT_WINDOW_HEIGHT), 0.1, 500.0);
+    gluPerspective(65, (double)view.w / (double)std::max(1, view.h), 0.1, 500.0);
+    // Projection scale
+    gPixelsPerUnit = 0.5f * view.h / std::tan(deg2rad(65.f * 0.5f));
     // Modelview mode
     glMatrixMode(GL_MODELVIEW);
     // Reset matrix
@@ -775,33 +3995,397 @@ static void setupCamera() {
     // Get basis
     Vector fwd, right, up; cameraBasis(fwd,right,up);
 
+    // Yaw rotation
+    const float cy = std::cos(deg2rad(view.yawOffset));
+    // Yaw rotation
+    const float sy = std::sin(deg2rad(view.yawOffset));
+    // Offset forward
+    const Vector yawFwd = add(mul(fwd, cy), mul(right, sy));
+    // Pitch rotation
+    const float cp = std::cos(deg2rad(view.pitchOffset));
+    // Pitch rotation
+    const float sp = std::sin(deg2rad(view.pitchOffset));
+    // View forward
+    const Vector viewFwd = add(mul(yawFwd, cp), mul(up, sp));
+
+    // Interpolate eye
+    const Vector eye = add(gCamPrevPos, mul(sub(gCamPos, gCamPrevPos), gSimAlpha));
     // Calculate target
-    const Vector target = add(gCamPos, fwd);
+    const Vector target = add(eye, viewFwd);
 
     // Set view
-    gluLookAt(gCamPos.x, gCamPos.y, gCamPos.z,
+    gluLookAt(eye.x, eye.y, eye.z,
               target.x,   target.y,   target.z,
               up.x, up.y, up.z);
 }
 
-// Render scene
-static void drawScene() {
+// Glow framebuffers
+GLuint gGlowFbo[2] = {0, 0};
+// Glow textures
+GLuint gGlowTex[2] = {0, 0};
+// Glow width
+int gGlowW = 0;
+// Glow height
+int gGlowH = 0;
+// Glow enabled
+bool gGlowEnabled = true;
+// Glow usable
+bool gGlowReady = false;
 
-    // Clear buffers
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+// Create glow targets
+static void initGlowTargets(int w, int h) {
+    // Quarter width
+    gGlowW = std::max(1, w / 4);
+    // Quarter height
+    gGlowH = std::max(1, h / 4);
+    // Assume usable
+    gGlowReady = true;
+
+    // Each target
+    for (int i = 0; i < 2; ++i) {
+        // Create texture
+        if (gGlowTex[i] == 0) {
+            // Generate texture
+            glGenTextures(1, &gGlowTex[i]);
+        }
+        // Bind texture
+        glBindTexture(GL_TEXTURE_2D, gGlowTex[i]);
+        // Allocate storage
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, gGlowW, gGlowH, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        // Linear minify
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        // Linear magnify
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        // Clamp S
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        // Clamp T
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        // Create framebuffer
+        if (gGlowFbo[i] == 0) {
+            // Generate framebuffer
+            glGenFramebuffersEXT(1, &gGlowFbo[i]);
+        }
+        // Bind framebuffer
+        glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, gGlowFbo[i]);
+        // Attach texture
+        glFramebufferTexture2DEXT(GL_FRAMEBUFFER_EXT, GL_COLOR_ATTACHMENT0_EXT, GL_TEXTURE_2D, gGlowTex[i], 0);
+        // Check completeness
+        if (glCheckFramebufferStatusEXT(GL_FRAMEBUFFER_EXT) != GL_FRAMEBUFFER_COMPLETE_EXT) {
+            // Mark unusable
+            gGlowReady = false;
+        }
+    }
+    // Restore framebuffer
+    glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, 0);
+    // Unbind texture
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+// Glow quad
+static void drawGlowQuad(float dx, float dy, float weight) {
+    // Tap weight
+    glColor4f(weight, weight, weight, 1.f);
+    // Begin quad
+    glBegin(GL_QUADS);
+    // Bottom left
+    glTexCoord2f(0.f + dx, 0.f + dy); glVertex2f(0.f, 0.f);
+    // Bottom right
+    glTexCoord2f(1.f + dx, 0.f + dy); glVertex2f(1.f, 0.f);
+    // Top right
+    glTexCoord2f(1.f + dx, 1.f + dy); glVertex2f(1.f, 1.f);
+    // Top left
+    glTexCoord2f(0.f + dx, 1.f + dy); glVertex2f(0.f, 1.f);
+    // End quad
+    glEnd();
+}
+
+// Blur pass
+static void glowBlurPass(GLuint dstFbo, GLuint srcTex, float stepX, float stepY) {
+    // Bind destination
+    glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, dstFbo);
+    // Clear target
+    glClear(GL_COLOR_BUFFER_BIT);
+    // Bind source
+    glBindTexture(GL_TEXTURE_2D, srcTex);
+    // Tap offsets
+    const float offsets[5] = {0.f, -1.f, 1.f, -2.5f, 2.5f};
+    // Tap weights
+    const float weights[5] = {0.32f, 0.22f, 0.22f, 0.12f, 0.12f};
+    // Each tap
+    for (int i = 0; i < 5; ++i) {
+        // Weighted tap
+        drawGlowQuad(offsets[i] * stepX, offsets[i] * stepY, weights[i]);
+    }
+}
+
+// Glow pass
+static void drawGlowPass() {
+    // Check enabled
+    if (!gGlowEnabled || !gGlowReady) {
+        // Skip glow
+        return;
+    }
+
+    // Window width
+    const int w = glutGet(GLUT_WINDOW_WIDTH);
+    // Window height
+    const int h = glutGet(GLUT_WINDOW_HEIGHT);
+
+    // Render sun
+    glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, gGlowFbo[0]);
+    // Glow viewport
+    glViewport(0, 0, gGlowW, gGlowH);
+    // Clear target
+    glClear(GL_COLOR_BUFFER_BIT);
+    // Disable lighting
+    glDisable(GL_LIGHTING);
+    // Disable depth
+    glDisable(GL_DEPTH_TEST);
+    // Sun colour
+    glColor3f(1.0f, 0.85f, 0.3f);
+    // Save matrix
+    glPushMatrix();
+    // Glow size
+    glScalef(4.4f, 4.4f, 4.4f);
+    // Draw sphere
+    glCallList(gSphereLods[1]);
+    // Restore matrix
+    glPopMatrix();
+
+    // Ortho projection
+    glMatrixMode(GL_PROJECTION);
+    // Save projection
+    glPushMatrix();
+    // Reset projection
+    glLoadIdentity();
+    // Unit ortho
+    glOrtho(0, 1, 0, 1, -1, 1);
+    // Modelview stack
+    glMatrixMode(GL_MODELVIEW);
+    // Save modelview
+    glPushMatrix();
+    // Reset modelview
+    glLoadIdentity();
+
+    // Enable texturing
+    glEnable(GL_TEXTURE_2D);
+    // Additive blend
+    glEnable(GL_BLEND);
+    // Accumulate taps
+    glBlendFunc(GL_ONE, GL_ONE);
+
+    // Horizontal blur
+    glowBlurPass(gGlowFbo[1], gGlowTex[0], 1.f / gGlowW, 0.f);
+    // Vertical blur
+    glowBlurPass(gGlowFbo[0], gGlowTex[1], 0.f, 1.f / gGlowH);
+
+    // Restore framebuffer
+    glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, 0);
+    // Restore viewport
+    glViewport(0, 0, w, h);
+    // Bind result
+    glBindTexture(GL_TEXTURE_2D, gGlowTex[0]);
+    // Composite glow
+    drawGlowQuad(0.f, 0.f, 1.f);
+
+    // Disable blend
+    glDisable(GL_BLEND);
+    // Disable texturing
+    glDisable(GL_TEXTURE_2D);
+    // Unbind texture
+    glBindTexture(GL_TEXTURE_2D, 0);
+    // Enable depth
+    glEnable(GL_DEPTH_TEST);
+    // Enable lighting
+    glEnable(GL_LIGHTING);
+    // Restore modelview
+    glPopMatrix();
+    // Projection stack
+    glMatrixMode(GL_PROJECTION);
+    // Restore projection
+    glPopMatrix();
+    // Modelview mode
+    glMatrixMode(GL_MODELVIEW);
+}
+
+// HUD text
+static void drawHudText(float x, float y, const char* text) {
+    // Set position
+    glRasterPos2f(x, y);
+    // Each character
+    for (const char* c = text; *c; ++c) {
+        // Draw character
+        glutBitmapCharacter(GLUT_BITMAP_9_BY_15, *c);
+    }
+}
+
+// Draw HUD
+static void drawHud() {
+    // Check visibility
+    if (!gShowHud || gProfSamples == 0) {
+        // Hidden
+        return;
+    }
+
+    // Sorted samples
+    double* sorted = arenaAllocT<double>(gFrameArena, gProfSamples);
+    // Copy history
+    std::memcpy(sorted, gProfFrameMs, gProfSamples * sizeof(double));
+    // Sort history
+    std::sort(sorted, sorted + gProfSamples);
+    // Minimum time
+    const double mn = sorted[0];
+    // P99 index
+    const size_t i99 = std::min((size_t)gProfSamples - 1, (size_t)(gProfSamples * 0.99));
+    // P99 time
+    const double p99 = sorted[i99];
+    // Sum accumulator
+    double sum = 0.0;
+    // Each sample
+    for (int i = 0; i < gProfSamples; ++i) {
+        // Accumulate
+        sum += sorted[i];
+    }
+    // Average time
+    const double avg = sum / gProfSamples;
+
+    // Window width
+    const int w = glutGet(GLUT_WINDOW_WIDTH);
+    // Window height
+    const int h = glutGet(GLUT_WINDOW_HEIGHT);
+
+    // Projection stack
+    glMatrixMode(GL_PROJECTION);
+    // Save projection
+    glPushMatrix();
+    // Reset projection
+    glLoadIdentity();
+    // Pixel ortho
+    glOrtho(0, w, 0, h, -1, 1);
+    // Modelview stack
+    glMatrixMode(GL_MODELVIEW);
+    // Save modelview
+    glPushMatrix();
+    // Reset modelview
+    glLoadIdentity();
+    // Disable lighting
+    glDisable(GL_LIGHTING);
+    // Disable depth
+    glDisable(GL_DEPTH_TEST);
+
+    // Text colour
+    glColor3f(1.f, 1.f, 0.6f);
+    // Line buffer
+    char line[128];
+    // Text row
+    float y = float(h) - 20.f;
+    // Frame summary
+    std::snprintf(line, sizeof(line), "frame ms  min %.2f  avg %.2f  p99 %.2f", mn, avg, p99);
+    // Draw summary
+    drawHudText(10.f, y, line);
+    // Each stage
+    for (int i = 0; i < ProfStageCount; ++i) {
+        // Next row
+        y -= 16.f;
+        // Stage line
+        std::snprintf(line, sizeof(line), "%-8s %.2f ms", profStageNames[i], gProfStageMs[i]);
+        // Draw stage
+        drawHudText(10.f, y, line);
+    }
+
+    // Enable depth
+    glEnable(GL_DEPTH_TEST);
+    // Enable lighting
+    glEnable(GL_LIGHTING);
+    // Restore modelview
+    glPopMatrix();
+    // Projection stack
+    glMatrixMode(GL_PROJECTION);
+    // Restore projection
+    glPopMatrix();
+    // Modelview mode
+    glMatrixMode(GL_MODELVIEW);
+}
+
+// Depth pre-pass
+static void drawOccluderDepthPass() {
+    // Mask colours
+    glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+    // Disable lighting
+    glDisable(GL_LIGHTING);
+
+    // Sun occluder
+    if (sphereInFrustum(0.f, 0.f, 0.f, 4.0f)) {
+        // Save matrix
+        glPushMatrix();
+        // Sun colour
+        const float sun[3] = {1.0f, 0.95f, 0.2f};
+        // Lay depth
+        drawSphere(4.0f, sun, 0.8f);
+        // Restore matrix
+        glPopMatrix();
+    }
+
+    // Each planet
+    for (int order : gPlanetDrawOrder) {
+        // Ordered planet
+        const Planet& p = gPlanets[order];
+        // Planet x
+        const float x = gBodyPosX[p.body];
+        // Planet z
+        const float z = gBodyPosZ[p.body];
+        // Cull planet
+        if (!sphereInFrustum(x, 0.f, z, p.radius)) {
+            // Skip planet
+            continue;
+        }
+        // Save matrix
+        glPushMatrix();
+        // Position planet
+        glTranslatef(x, 0.0f, z);
+        // Tilt planet
+        glRotatef(p.tilt, 0,0,1);
+        // Lay depth
+        drawSphere(p.radius, p.colour, 0.0f, Vector{x, 0.f, z});
+        // Restore matrix
+        glPopMatrix();
+    }
+
+    // Hull occluder
+    drawEnterpriseMesh();
+
+    // Enable lighting
+    glEnable(GL_LIGHTING);
+    // Unmask colours
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+}
+
+// Render view
+static void drawSceneView(const ViewDesc& view) {
     // Setup camera
-    setupCamera();
+    setupCamera(view);
+    // Extract frustum
+    extractFrustum();
 
     // Light position
     const GLfloat lightPos[] = {0,0,0,1};
     // Update light
     glLightfv(GL_LIGHT0, GL_POSITION, lightPos);
 
+    // Begin stars
+    profBegin(ProfStars);
+    // Occluder depths
+    drawOccluderDepthPass();
     // Draw stars
-    drawStars(gElapsedS);
+    drawStars();
+    // End stars
+    profEnd(ProfStars);
 
     // Check orbits
     if (gShowOrbits) {
+        // Begin rings
+        profBegin(ProfRings);
         // Disable lighting
         glDisable(GL_LIGHTING);
         // Set colour
@@ -809,19 +4393,32 @@ static void drawScene() {
 
         // Each planet
         for (const auto& p : gPlanets) {
-
-            // Orbit X radius
-            const float rx = p.orbitRX;
-            // Orbit Z radius
-            const float rz = p.orbitRY;
-            // Draw ring
-            drawOrbitRingLines(rx, rz, 256, 0.0f);
+            // Ring bound
+            const float ringR = std::max(p.orbitRX, p.orbitRY);
+            // Cull ring
+            if (!sphereInFrustum(0.f, 0.f, 0.f, ringR)) {
+                // Skip ring
+                continue;
+            }
+            // Draw cached ring
+            drawOrbitRing(p.ring);
         }
         // Re-enable lighting
         glEnable(GL_LIGHTING);
+        // End rings
+        profEnd(ProfRings);
     }
-    // Sun scope
-    {
+    // Check trails
+    if (gShowTrails) {
+        // Begin rings
+        profBegin(ProfRings);
+        // Draw trails
+        drawTrails();
+        // End rings
+        profEnd(ProfRings);
+    }
+    // Sun visible
+    if (sphereInFrustum(0.f, 0.f, 0.f, 4.0f)) {
         // Save matrix
         glPushMatrix();
         // Sun colour
@@ -832,15 +4429,23 @@ static void drawScene() {
         glPopMatrix();
     }
 
+    // Begin planets
+    profBegin(ProfPlanets);
     // Each planet
-    for (auto& p : gPlanets) {
+    for (int order : gPlanetDrawOrder) {
+        // Ordered planet
+        Planet& p = gPlanets[order];
 
-        // Convert angle
-        const float ang = deg2rad(p.angle);
-        // Calculate x
-        const float x = p.orbitRX * std::cos(ang);
-        // Calculate z
-        const float z = p.orbitRY * std::sin(ang);
+        // Planet x
+        const float x = gBodyPosX[p.body];
+        // Planet z
+        const float z = gBodyPosZ[p.body];
+
+        // Cull planet
+        if (!sphereInFrustum(x, 0.f, z, planetBoundRadius(p))) {
+            // Skip planet
+            continue;
+        }
 
         // Save matrix
         glPushMatrix();
@@ -849,19 +4454,23 @@ static void drawScene() {
         // Tilt planet
         glRotatef(p.tilt, 0,0,1);
         // Draw planet
-        drawSphere(p.radius, p.colour);
+        drawSphere(p.radius, p.colour, 0.0f, Vector{x, 0.f, z});
 
         // Each moon
         for (auto& m : p.moons) {
 
+            // Cull moon
+            if (!sphereInFrustum(x, 0.f, z, m.orbitR + m.radius)) {
+                // Skip moon
+                continue;
+            }
+
             // Save matrix
             glPushMatrix();
-            // Convert angle
-            const float ma = deg2rad(m.angle);
-            // Calculate x
-            const float mx = m.orbitR * std::cos(ma);
-            // Calculate z
-            const float mz = m.orbitR * std::sin(ma);
+            // Moon offset x
+            const float mx = gBodyLocalX[m.body];
+            // Moon offset z
+            const float mz = gBodyLocalZ[m.body];
 
             // Check orbits
             if (gShowOrbits) {
@@ -869,8 +4478,8 @@ static void drawScene() {
                 glDisable(GL_LIGHTING);
                 // Set colour
                 glColor3f(1.0f, 1.0f, 1.0f);
-                // Draw ring
-                drawOrbitRingLines(m.orbitR, m.orbitR, 96, 0.0f);
+                // Draw cached ring
+                drawOrbitRing(m.ring);
                 // Re-enable lighting
                 glEnable(GL_LIGHTING);
             }
@@ -878,32 +4487,211 @@ static void drawScene() {
             // Position moon
             glTranslatef(mx, 0.0f, mz);
             // Draw moon
-            drawSphere(m.radius, m.colour);
+            drawSphere(m.radius, m.colour, 0.0f, Vector{gBodyPosX[m.body], 0.f, gBodyPosZ[m.body]});
             // Restore matrix
             glPopMatrix();
         }
         // Restore matrix
         glPopMatrix();
     }
+    // Draw belt
+    drawBelt();
+    // End planets
+    profEnd(ProfPlanets);
 
+    // Begin mesh
+    profBegin(ProfMesh);
     // Draw Enterprise
     drawEnterpriseMesh();
+    // End mesh
+    profEnd(ProfMesh);
+}
+
+// Render scene
+static void drawScene() {
+
+    // Clear buffers
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    // Shared evaluation
+    evaluateBodyPositions(gSimAlpha);
+
+    // Each view
+    for (int v = 0; v < gViewCount; ++v) {
+        // Render tile
+        drawSceneView(viewDescFor(v));
+    }
+
+    // Single view
+    if (gViewCount == 1) {
+        // Glow pass
+        drawGlowPass();
+    } else {
+        // Full viewport
+        glViewport(0, 0, glutGet(GLUT_WINDOW_WIDTH), glutGet(GLUT_WINDOW_HEIGHT));
+    }
+    // Draw HUD
+    drawHud();
     // Swap buffers
     glutSwapBuffers();
 }
 
+// Script camera
+static void benchScriptCamera(int frame) {
+    // Run phase
+    const float phase = float(frame) / float(std::max(1, gBenchFrames));
+    // Clear keys
+    kForward = kBackward = kUp = kDown = kRight = kLeft = false;
+    // Approach phase
+    if (phase < 0.35f) {
+        // Fly forward
+        kForward = true;
+    }
+    // Strafe phase
+    else if (phase < 0.6f) {
+        // Fly right
+        kRight = true;
+    }
+    // Climb phase
+    else if (phase < 0.8f) {
+        // Fly up
+        kUp = true;
+        // Keep moving
+        kForward = true;
+    }
+    // Retreat phase
+    else {
+        // Fly backward
+        kBackward = true;
+    }
+}
+
+// Benchmark report
+static void benchReport() {
+    // Sorted totals
+    std::vector<double> sorted = gBenchTotals;
+    // Sort samples
+    std::sort(sorted.begin(), sorted.end());
+    // Sample count
+    const size_t n = sorted.size();
+    // Check empty
+    if (n == 0) {
+        // Nothing measured
+        return;
+    }
+
+    // Sum accumulator
+    double sum = 0.0;
+    // Each sample
+    for (double v : sorted) {
+        // Accumulate
+        sum += v;
+    }
+    // P99 index
+    const size_t i99 = std::min(n - 1, (size_t)(n * 0.99));
+
+    // Report header
+    std::printf("BENCHMARK  %zu frames\n", n);
+    // Separator
+    std::printf("-------------------------------\n");
+    // Frame totals
+    std::printf("frame ms   min %.3f  avg %.3f  p99 %.3f  max %.3f\n",
+                sorted.front(), sum / n, sorted[i99], sorted.back());
+    // Each stage
+    for (int i = 0; i < ProfStageCount; ++i) {
+        // Stage average
+        std::printf("%-8s   avg %.3f ms\n", profStageNames[i], gBenchStageMs[i] / n);
+    }
+    // Separator
+    std::printf("-------------------------------\n");
+}
+
 // Display callback
 static void display() {
+    // Frame start
+    const double frameStart = profNowMs();
+    // Recycle frame arena
+    arenaReset(gFrameArena);
+    // Reset profiler
+    profFrameReset();
     // Get time
     const int now = glutGet(GLUT_ELAPSED_TIME);
     // Calculate delta
-    const float dt = (now - gPrevMillis) / 1000.0f;
+    float dt = (now - gPrevMillis) / 1000.0f;
     // Update previous
     gPrevMillis = now;
-    // Update angles
-    updateAngles(dt);
+    // Clamp spikes
+    if (dt > simMaxFrameDt) {
+        // Cap delta
+        dt = simMaxFrameDt;
+    }
+
+    // Benchmark frame
+    if (gBenchMode) {
+        // Deterministic delta
+        dt = 1.0f / 60.0f;
+        // Scripted input
+        benchScriptCamera(gBenchFrameIndex);
+    }
+
+    // Accumulate time
+    gSimAccumulator += dt;
+    // Track simulation
+    allocSetPhase(AllocSim);
+    // Begin simulation
+    profBegin(ProfSim);
+    // Fixed steps
+    while (gSimAccumulator >= simDt) {
+        // Advance simulation
+        updateAngles(simDt);
+        // Consume step
+        gSimAccumulator -= simDt;
+    }
+    // End simulation
+    profEnd(ProfSim);
+    // Render alpha
+    gSimAlpha = float(gSimAccumulator / simDt);
+
+    // Adopt loaded mesh
+    pollEnterpriseLoad();
+    // Track drawing
+    allocSetPhase(AllocDraw);
+    // Adopt task results
+    finishFrameTask();
+    // Kick next task
+    kickFrameTask();
     // Render scene
     drawScene();
+    // Report allocations
+    allocFrameReport();
+    // Record frame
+    profFrameRecord(profNowMs() - frameStart);
+    // Steer quality
+    if (!gBenchMode) {
+        // Governor step
+        qualityGovernorUpdate();
+    }
+
+    // Benchmark bookkeeping
+    if (gBenchMode) {
+        // Store total
+        gBenchTotals.push_back(profNowMs() - frameStart);
+        // Each stage
+        for (int i = 0; i < ProfStageCount; ++i) {
+            // Accumulate stage
+            gBenchStageMs[i] += gProfStageMs[i];
+        }
+        // Run finished
+        if (++gBenchFrameIndex >= gBenchFrames) {
+            // Print report
+            benchReport();
+            // Reap loader
+            joinEnterpriseLoader();
+            // Stop workers
+            shutdownWorkerPool();
+            // Exit run
+            std::exit(0);
+        }
+    }
 }
 
 // Idle callback
@@ -916,6 +4704,8 @@ static void idle() {
 static void reshape(int w, int h) {
     // Set viewport
     glViewport(0, 0, w, h);
+    // Resize glow
+    initGlowTargets(w, h);
 }
 
 // Keyboard callback
@@ -925,6 +4715,46 @@ static void keyboard(unsigned char key, int, int) {
         // Toggle orbits
         gShowOrbits = !gShowOrbits;
     }
+    // Check P
+    if (key == 'p' || key == 'P') {
+        // Toggle HUD
+        gShowHud = !gShowHud;
+    }
+    // Check C
+    if (key == 'c' || key == 'C') {
+        // Toggle CSV
+        profToggleCsv();
+    }
+    // Check L
+    if (key == 'l' || key == 'L') {
+        // Reload model
+        startEnterpriseLoad();
+    }
+    // Check G
+    if (key == 'g' || key == 'G') {
+        // Toggle glow
+        gGlowEnabled = !gGlowEnabled;
+    }
+    // Check V
+    if (key == 'v' || key == 'V') {
+        // Cycle layouts
+        gViewCount = (gViewCount == 1) ? 2 : (gViewCount == 2 ? 4 : 1);
+    }
+    // Check T
+    if (key == 't' || key == 'T') {
+        // Toggle trails
+        gShowTrails = !gShowTrails;
+    }
+    // Check N
+    if (key == 'n' || key == 'N') {
+        // Toggle gravity
+        gNBodyMode = !gNBodyMode;
+        // Entering mode
+        if (gNBodyMode) {
+            // Seed physics
+            enterNBodyMode();
+        }
+    }
 }
 
 // Handle special
@@ -978,6 +4808,66 @@ int main(int argc, char** argv) {
 
     // Initialize GLUT
     glutInit(&argc, argv);
+
+    // Each argument
+    for (int i = 1; i < argc; ++i) {
+        // Generator flag
+        if (std::strcmp(argv[i], "--gen") == 0 && i + 2 < argc) {
+            // Enable generator
+            gUseGenerator = true;
+            // Parse seed
+            gGenSeed = std::strtoull(argv[i + 1], nullptr, 10);
+            // Parse count
+            gGenPlanetCount = std::atoi(argv[i + 2]);
+            // Clamp count
+            gGenPlanetCount = std::max(1, gGenPlanetCount);
+            // Consume values
+            i += 2;
+        }
+        // Twinkle flag
+        else if (std::strcmp(argv[i], "--twinkle") == 0 && i + 1 < argc) {
+            // Parse slices
+            gTwinkleSlices = std::max(1, std::atoi(argv[i + 1]));
+            // Consume value
+            i += 1;
+        }
+        // Benchmark flag
+        else if (std::strcmp(argv[i], "--bench") == 0 && i + 1 < argc) {
+            // Enable benchmark
+            gBenchMode = true;
+            // Parse frames
+            gBenchFrames = std::max(1, std::atoi(argv[i + 1]));
+            // Reserve totals
+            gBenchTotals.reserve(gBenchFrames);
+            // Consume value
+            i += 1;
+        }
+        // Scene flag
+        else if (std::strcmp(argv[i], "--scene") == 0 && i + 1 < argc) {
+            // Enable scene
+            gUseSceneFile = true;
+            // Store path
+            gScenePath = argv[i + 1];
+            // Consume value
+            i += 1;
+        }
+        // Belt flag
+        else if (std::strcmp(argv[i], "--belt") == 0 && i + 1 < argc) {
+            // Parse rocks
+            gBeltCount = std::max(0, std::atoi(argv[i + 1]));
+            // Consume value
+            i += 1;
+        }
+        // Views flag
+        else if (std::strcmp(argv[i], "--views") == 0 && i + 1 < argc) {
+            // Parse count
+            const int views = std::atoi(argv[i + 1]);
+            // Accept layouts
+            gViewCount = (views == 2 || views == 4) ? views : 1;
+            // Consume value
+            i += 1;
+        }
+    }
     // Set display mode
     glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGB | GLUT_DEPTH);
     // Set Window Size